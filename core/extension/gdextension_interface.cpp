@@ -1266,6 +1266,70 @@ static GDExtensionTypePtr gdextension_packed_vector4_array_operator_index_const(
 	return (GDExtensionTypePtr)&self->ptr()[p_index];
 }
 
+template <typename T>
+static const void *_packed_array_get_read_ptr(GDExtensionConstTypePtr p_self, GDExtensionInt *r_size) {
+	const Vector<T> *self = (const Vector<T> *)p_self;
+	if (r_size) {
+		*r_size = self->size();
+	}
+	return self->ptr();
+}
+
+template <typename T>
+static void *_packed_array_get_write_ptr(GDExtensionTypePtr p_self, GDExtensionInt *r_size) {
+	Vector<T> *self = (Vector<T> *)p_self;
+	if (r_size) {
+		*r_size = self->size();
+	}
+	// Copies the data only if it's shared with another array.
+	return self->ptrw();
+}
+
+template <typename T>
+static void _packed_array_move(GDExtensionTypePtr p_dest, GDExtensionTypePtr p_src) {
+	*(Vector<T> *)p_dest = std::move(*(Vector<T> *)p_src);
+}
+
+#define PACKED_ARRAY_DISPATCH(m_func, m_fail_ret, ...)                                                                           \
+	switch ((Variant::Type)p_type) {                                                                                             \
+		case Variant::PACKED_BYTE_ARRAY:                                                                                         \
+			return m_func<uint8_t>(__VA_ARGS__);                                                                                 \
+		case Variant::PACKED_INT32_ARRAY:                                                                                        \
+			return m_func<int32_t>(__VA_ARGS__);                                                                                 \
+		case Variant::PACKED_INT64_ARRAY:                                                                                        \
+			return m_func<int64_t>(__VA_ARGS__);                                                                                 \
+		case Variant::PACKED_FLOAT32_ARRAY:                                                                                      \
+			return m_func<float>(__VA_ARGS__);                                                                                   \
+		case Variant::PACKED_FLOAT64_ARRAY:                                                                                      \
+			return m_func<double>(__VA_ARGS__);                                                                                  \
+		case Variant::PACKED_STRING_ARRAY:                                                                                       \
+			return m_func<String>(__VA_ARGS__);                                                                                  \
+		case Variant::PACKED_VECTOR2_ARRAY:                                                                                      \
+			return m_func<Vector2>(__VA_ARGS__);                                                                                 \
+		case Variant::PACKED_VECTOR3_ARRAY:                                                                                      \
+			return m_func<Vector3>(__VA_ARGS__);                                                                                 \
+		case Variant::PACKED_COLOR_ARRAY:                                                                                        \
+			return m_func<Color>(__VA_ARGS__);                                                                                   \
+		case Variant::PACKED_VECTOR4_ARRAY:                                                                                      \
+			return m_func<Vector4>(__VA_ARGS__);                                                                                 \
+		default:                                                                                                                 \
+			ERR_FAIL_V_MSG(m_fail_ret, vformat("Type %s isn't a packed array.", Variant::get_type_name((Variant::Type)p_type))); \
+	}
+
+static const void *gdextension_packed_array_get_read_ptr(GDExtensionConstTypePtr p_self, GDExtensionVariantType p_type, GDExtensionInt *r_size) {
+	PACKED_ARRAY_DISPATCH(_packed_array_get_read_ptr, nullptr, p_self, r_size);
+}
+
+static void *gdextension_packed_array_get_write_ptr(GDExtensionTypePtr p_self, GDExtensionVariantType p_type, GDExtensionInt *r_size) {
+	PACKED_ARRAY_DISPATCH(_packed_array_get_write_ptr, nullptr, p_self, r_size);
+}
+
+static void gdextension_packed_array_move(GDExtensionTypePtr p_dest, GDExtensionTypePtr p_src, GDExtensionVariantType p_type) {
+	PACKED_ARRAY_DISPATCH(_packed_array_move, void(), p_dest, p_src);
+}
+
+#undef PACKED_ARRAY_DISPATCH
+
 static GDExtensionVariantPtr gdextension_array_operator_index(GDExtensionTypePtr p_self, GDExtensionInt p_index) {
 	Array *self = (Array *)p_self;
 	if (unlikely(p_index < 0 || p_index >= self->size())) {
@@ -1795,6 +1859,9 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(packed_vector3_array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(packed_vector4_array_operator_index);
 	REGISTER_INTERFACE_FUNC(packed_vector4_array_operator_index_const);
+	REGISTER_INTERFACE_FUNC(packed_array_get_read_ptr);
+	REGISTER_INTERFACE_FUNC(packed_array_get_write_ptr);
+	REGISTER_INTERFACE_FUNC(packed_array_move);
 	REGISTER_INTERFACE_FUNC(array_operator_index);
 	REGISTER_INTERFACE_FUNC(array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(array_ref);
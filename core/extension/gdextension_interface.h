@@ -2353,6 +2353,54 @@ typedef GDExtensionTypePtr (*GDExtensionInterfacePackedColorArrayOperatorIndex)(
  */
 typedef GDExtensionTypePtr (*GDExtensionInterfacePackedColorArrayOperatorIndexConst)(GDExtensionConstTypePtr p_self, GDExtensionInt p_index);
 
+/**
+ * @name packed_array_get_read_ptr
+ * @since 4.5
+ *
+ * Gets a const pointer to the contiguous data of any packed array, without copying it or changing its reference count.
+ *
+ * The pointer is borrowed: it stays valid only as long as the packed array isn't modified or destroyed.
+ *
+ * @param p_self A const pointer to a packed array object.
+ * @param p_type The Variant type of the packed array (e.g. GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY).
+ * @param r_size A pointer to store the number of elements in, or NULL.
+ *
+ * @return A const pointer to the first element, or NULL if the array is empty or p_type isn't a packed array type.
+ */
+typedef const void *(*GDExtensionInterfacePackedArrayGetReadPtr)(GDExtensionConstTypePtr p_self, GDExtensionVariantType p_type, GDExtensionInt *r_size);
+
+/**
+ * @name packed_array_get_write_ptr
+ * @since 4.5
+ *
+ * Gets a pointer to the contiguous data of any packed array for writing.
+ *
+ * The data is copied only if it is shared with another packed array, and only once for the whole array,
+ * unlike writing through the per-element `operator_index` functions. The pointer stays valid only as long
+ * as the packed array isn't resized, copied or destroyed.
+ *
+ * @param p_self A pointer to a packed array object.
+ * @param p_type The Variant type of the packed array (e.g. GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY).
+ * @param r_size A pointer to store the number of elements in, or NULL.
+ *
+ * @return A pointer to the first element, or NULL if the array is empty or p_type isn't a packed array type.
+ */
+typedef void *(*GDExtensionInterfacePackedArrayGetWritePtr)(GDExtensionTypePtr p_self, GDExtensionVariantType p_type, GDExtensionInt *r_size);
+
+/**
+ * @name packed_array_move
+ * @since 4.5
+ *
+ * Transfers the data of a packed array to another one of the same type, without copying it or changing its reference count.
+ *
+ * The previous contents of p_dest are released, and p_src is left empty.
+ *
+ * @param p_dest A pointer to the packed array receiving the data.
+ * @param p_src A pointer to the packed array giving up its data.
+ * @param p_type The Variant type of both packed arrays (e.g. GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY).
+ */
+typedef void (*GDExtensionInterfacePackedArrayMove)(GDExtensionTypePtr p_dest, GDExtensionTypePtr p_src, GDExtensionVariantType p_type);
+
 /**
  * @name array_operator_index
  * @since 4.1
@@ -37,6 +37,21 @@
 #include "core/string/ustring.h"
 #include "core/typedefs.h"
 
+/**
+ * Read-only mapping of a whole file, released with the last reference to it.
+ */
+class FileMapping : public RefCounted {
+protected:
+	const uint8_t *data = nullptr;
+	uint64_t size = 0;
+
+public:
+	_FORCE_INLINE_ const uint8_t *get_data() const { return data; }
+	_FORCE_INLINE_ uint64_t get_size() const { return size; }
+	// Hints that the range is going to be read soon.
+	virtual void prefetch(uint64_t p_offset, uint64_t p_length) const {}
+};
+
 /**
  * Multi-Platform abstraction for accessing to files.
  */
@@ -178,6 +193,28 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	/**
+	 * Borrows the next p_length bytes without copying them and advances the position, or returns nullptr
+	 * (leaving the position untouched) when the implementation can't, in which case use get_buffer() instead.
+	 * The returned memory is read-only and stays valid until the file is closed.
+	 */
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; }
+	/**
+	 * Maps the whole file read-only, or returns an invalid reference when the implementation can't.
+	 * The mapping doesn't depend on the file, so it can be shared and kept after the file is closed.
+	 */
+	virtual Ref<FileMapping> create_mapping() const { return Ref<FileMapping>(); }
+
+	// Receives the amount of bytes read (less than requested past the end of file), or -1 on failure.
+	typedef void (*AsyncReadCallback)(void *p_userdata, int64_t p_read);
+	/**
+	 * Reads p_length bytes at p_position into p_dst in the background, without using or moving the file position.
+	 * p_callback, if any, is called once done, usually from another thread. p_dst and the file must stay valid until then.
+	 * A null p_dst only brings the range into the OS cache, for data that is going to be read soon.
+	 * Returns false without calling p_callback when the implementation can't read in the background.
+	 */
+	virtual bool read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) { return false; }
+
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -30,6 +30,55 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+
+struct FileAccessCompressedBlocks {
+	Compression::Mode mode = Compression::MODE_ZSTD;
+	uint32_t block_size = 0;
+	uint32_t total = 0;
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	// Where each compressed block starts in src when decompressing.
+	const uint64_t *src_offsets = nullptr;
+	// Compressed block sizes, read when decompressing and written when compressing.
+	int *sizes = nullptr;
+	// Room for each compressed block in dst when compressing.
+	int dst_stride = 0;
+	SafeFlag failed;
+
+	static void decompress(void *p_userdata, uint32_t p_block) {
+		FileAccessCompressedBlocks *blocks = (FileAccessCompressedBlocks *)p_userdata;
+		int ret = Compression::decompress(blocks->dst + (uint64_t)p_block * blocks->block_size, blocks->block_size, blocks->src + blocks->src_offsets[p_block], blocks->sizes[p_block], blocks->mode);
+		if (ret != (int)blocks->block_size) {
+			blocks->failed.set();
+		}
+	}
+
+	static void compress(void *p_userdata, uint32_t p_block) {
+		FileAccessCompressedBlocks *blocks = (FileAccessCompressedBlocks *)p_userdata;
+		uint64_t from = (uint64_t)p_block * blocks->block_size;
+		uint32_t size = MIN((uint64_t)blocks->block_size, blocks->total - from);
+		blocks->sizes[p_block] = Compression::compress(blocks->dst + (uint64_t)p_block * blocks->dst_stride, blocks->src + from, size, blocks->mode);
+		if (blocks->sizes[p_block] < 0) {
+			blocks->failed.set();
+		}
+	}
+
+	void run(void (*p_func)(void *, uint32_t), uint32_t p_count) {
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		// Waiting on a group from inside the pool could starve it, so pool threads stay serial.
+		if (p_count >= FileAccessCompressed::PARALLEL_MIN_BLOCKS && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+			WorkerThreadPool::GroupID group = pool->add_native_group_task(p_func, this, p_count, -1, true, "FileAccessCompressed");
+			pool->wait_for_group_task_completion(group);
+			return;
+		}
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_func(this, i);
+		}
+	}
+};
+
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
@@ -111,6 +160,51 @@ Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags
 	return OK;
 }
 
+Vector<uint8_t> FileAccessCompressed::compress_blocks(const uint8_t *p_data, uint32_t p_size, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V(!p_data && p_size > 0, Vector<uint8_t>());
+
+	uint32_t bc = (p_size / p_block_size) + 1;
+	int max_csize = Compression::get_max_compressed_buffer_size(p_block_size, p_mode);
+
+	Vector<uint8_t> cblocks;
+	ERR_FAIL_COND_V(cblocks.resize((uint64_t)bc * max_csize) != OK, Vector<uint8_t>());
+	Vector<int> block_sizes;
+	block_sizes.resize(bc);
+
+	FileAccessCompressedBlocks blocks;
+	blocks.mode = p_mode;
+	blocks.block_size = p_block_size;
+	blocks.total = p_size;
+	blocks.src = p_data;
+	blocks.dst = cblocks.ptrw();
+	blocks.sizes = block_sizes.ptrw();
+	blocks.dst_stride = max_csize;
+	blocks.run(&FileAccessCompressedBlocks::compress, bc);
+	ERR_FAIL_COND_V(blocks.failed.is_set(), Vector<uint8_t>());
+
+	uint64_t total_size = 12 + bc * 4;
+	for (uint32_t i = 0; i < bc; i++) {
+		total_size += block_sizes[i];
+	}
+
+	Vector<uint8_t> out;
+	ERR_FAIL_COND_V(out.resize(total_size) != OK, Vector<uint8_t>());
+	uint8_t *w = out.ptrw();
+	w += encode_uint32(p_mode, w); //compression mode 4
+	w += encode_uint32(p_block_size, w); //block size 4
+	w += encode_uint32(p_size, w); //max amount of data written 4
+	for (uint32_t i = 0; i < bc; i++) {
+		w += encode_uint32(block_sizes[i], w);
+	}
+	for (uint32_t i = 0; i < bc; i++) {
+		memcpy(w, &cblocks[(uint64_t)i * max_csize], block_sizes[i]);
+		w += block_sizes[i];
+	}
+
+	return out;
+}
+
 void FileAccessCompressed::_close() {
 	if (f.is_null()) {
 		return;
@@ -121,33 +215,7 @@ void FileAccessCompressed::_close() {
 
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(uint32_t(write_max)); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
-
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(uint32_t(block_sizes[i]));
-		}
-		f->seek_end();
+		f->store_buffer(compress_blocks(write_ptr, uint32_t(write_max), cmode, block_size)); //header, block table and blocks
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
 
 		buffer.clear();
@@ -246,6 +314,35 @@ bool FileAccessCompressed::eof_reached() const {
 	}
 }
 
+Error FileAccessCompressed::_decompress_blocks(uint32_t p_from, uint32_t p_count, uint8_t *p_dst) const {
+	// Blocks are stored back to back, so they're read in one go.
+	uint64_t start = read_blocks[p_from].offset;
+	uint64_t csize = read_blocks[p_from + p_count - 1].offset + read_blocks[p_from + p_count - 1].csize - start;
+	Vector<uint8_t> cblocks;
+	ERR_FAIL_COND_V(cblocks.resize(csize) != OK, ERR_OUT_OF_MEMORY);
+	ERR_FAIL_COND_V(f->get_buffer(cblocks.ptrw(), csize) != csize, ERR_FILE_CORRUPT);
+
+	LocalVector<uint64_t> offsets;
+	LocalVector<int> sizes;
+	offsets.resize(p_count);
+	sizes.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		offsets[i] = read_blocks[p_from + i].offset - start;
+		sizes[i] = read_blocks[p_from + i].csize;
+	}
+
+	FileAccessCompressedBlocks blocks;
+	blocks.mode = cmode;
+	blocks.block_size = block_size;
+	blocks.src = cblocks.ptr();
+	blocks.dst = p_dst;
+	blocks.src_offsets = offsets.ptr();
+	blocks.sizes = sizes.ptr();
+	blocks.run(&FileAccessCompressedBlocks::decompress, p_count);
+
+	return blocks.failed.is_set() ? ERR_FILE_CORRUPT : OK;
+}
+
 uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
@@ -256,29 +353,44 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
+	uint64_t dst_pos = 0;
+	while (dst_pos < p_length) {
+		uint64_t to_copy = MIN(p_length - dst_pos, (uint64_t)(read_block_size - read_pos));
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, to_copy);
+		dst_pos += to_copy;
+		read_pos += to_copy;
+		if (read_pos < read_block_size) {
+			break;
+		}
 
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
-
-			} else {
-				read_block--;
-				at_end = true;
-				if (i + 1 < p_length) {
-					read_eof = true;
-				}
-				return i + 1;
+		if (read_block + 1 >= read_block_count) {
+			at_end = true;
+			if (dst_pos < p_length) {
+				read_eof = true;
 			}
+			return dst_pos;
 		}
+
+		// Full blocks (except the last, shorter one) covered by the rest of the read are decompressed in place.
+		uint32_t whole_blocks = MIN((p_length - dst_pos) / block_size, (uint64_t)(read_block_count - read_block - 2));
+		if (whole_blocks >= PARALLEL_MIN_BLOCKS) {
+			ERR_FAIL_COND_V_MSG(_decompress_blocks(read_block + 1, whole_blocks, p_dst + dst_pos) != OK, -1, "Compressed file is corrupt.");
+			read_block += whole_blocks;
+			dst_pos += (uint64_t)whole_blocks * block_size;
+			// Keep the current block loaded, seeking within it doesn't reload it.
+			memcpy(read_ptr, p_dst + dst_pos - block_size, block_size);
+			read_block_size = block_size;
+			read_pos = block_size;
+			continue;
+		}
+
+		//read another block of compressed data
+		read_block++;
+		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
+		int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
+		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
+		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		read_pos = 0;
 	}
 
 	return p_length;
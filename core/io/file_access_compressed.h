@@ -63,11 +63,17 @@ class FileAccessCompressed : public FileAccess {
 	Ref<FileAccess> f;
 
 	void _close();
+	Error _decompress_blocks(uint32_t p_from, uint32_t p_count, uint8_t *p_dst) const;
 
 public:
+	// Reads spanning at least this many whole blocks decompress them in parallel.
+	static constexpr uint32_t PARALLEL_MIN_BLOCKS = 4;
+
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
+	// Compresses p_data into the layout open_after_magic() reads (everything after the magic).
+	static Vector<uint8_t> compress_blocks(const uint8_t *p_data, uint32_t p_size, Compression::Mode p_mode, uint32_t p_block_size);
 
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
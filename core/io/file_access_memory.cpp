@@ -141,6 +141,32 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessMemory::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V(data, nullptr);
+
+	if (pos > length || p_length > length - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = &data[pos];
+	pos += p_length;
+	return view;
+}
+
+bool FileAccessMemory::read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_NULL_V(data, false);
+
+	// Nothing to wait for, completes right away.
+	uint64_t read = p_position < length ? MIN(p_length, length - p_position) : 0;
+	if (p_dst && read > 0) {
+		memcpy(p_dst, &data[p_position], read);
+	}
+	if (p_callback) {
+		p_callback(p_userdata, read);
+	}
+	return true;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
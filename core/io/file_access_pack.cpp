@@ -30,6 +30,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -45,7 +46,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -53,6 +54,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -152,8 +154,21 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 	}
 }
 
+Ref<FileMapping> PackedData::_get_pack_mapping(const String &p_pack, const Ref<FileAccess> &p_file) {
+	MutexLock lock(pack_mappings_mutex);
+	HashMap<String, Ref<FileMapping>>::Iterator E = pack_mappings.find(p_pack);
+	if (!E) {
+		E = pack_mappings.insert(p_pack, p_file->create_mapping());
+	}
+	return E->value;
+}
+
 void PackedData::clear() {
 	files.clear();
+	{
+		MutexLock lock(pack_mappings_mutex);
+		pack_mappings.clear();
+	}
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -263,7 +278,8 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
+	// Version 3 only adds compressed files.
+	ERR_FAIL_COND_V_MSG(version < 2 || version > PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, vformat("Pack created with a newer version of the engine: %d.%d.", ver_major, ver_minor));
 
 	uint32_t pack_flags = f->get_32();
@@ -318,7 +334,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
@@ -435,6 +451,39 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+
+	if (eof || pos + p_length > pf.size || pf.encrypted || pf.compressed) {
+		// Encrypted and compressed files can't provide views.
+		return nullptr;
+	}
+
+	// Borrows from the mapping of the pack, which all its files share.
+	if (!mapping_checked) {
+		mapping_checked = true;
+		mapping = PackedData::get_singleton()->_get_pack_mapping(pf.pack, f);
+	}
+	if (mapping.is_null() || off + pos + p_length > mapping->get_size()) {
+		return nullptr;
+	}
+
+	const uint64_t view_ofs = off + pos;
+	pos += p_length;
+	f->seek(off + pos);
+	mapping->prefetch(view_ofs, p_length);
+	return mapping->get_data() + view_ofs;
+}
+
+bool FileAccessPack::read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_COND_V_MSG(f.is_null(), false, "File must be opened before use.");
+
+	p_position = MIN(p_position, pf.size);
+	p_length = MIN(p_length, pf.size - p_position);
+	// Reads from the pack directly, encrypted and compressed files can't read in the background.
+	return f->read_async(off + p_position, p_dst, p_length, p_callback, p_userdata);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -463,6 +512,7 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapping.unref();
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
@@ -489,6 +539,20 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		char magic[5] = {};
+		f->get_buffer((uint8_t *)magic, 4);
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure(PACK_COMPRESSED_MAGIC);
+		if (String(magic) != PACK_COMPRESSED_MAGIC || fac->open_after_magic(f) != OK) {
+			f.unref(); // Don't hand out the compressed data as is.
+			ERR_FAIL_MSG(vformat("Can't open compressed pack-referenced file '%s'.", String(pf.pack)));
+		}
+		f = fac;
+		off = 0;
+	}
 	pos = 0;
 	eof = false;
 }
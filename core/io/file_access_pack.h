@@ -32,6 +32,7 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
@@ -39,7 +40,13 @@
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// Written instead for packs without compressed files, so older versions of the engine can still load them.
+#define PACK_FORMAT_VERSION_UNCOMPRESSED 2
+// Block size of files compressed in a pack, each block can be decompressed on its own.
+#define PACK_COMPRESSED_BLOCK_SIZE (64 * 1024)
+// Magic of compressed files in a pack ("GCPF" in ASCII), followed by a FileAccessCompressed block table.
+#define PACK_COMPRESSED_MAGIC "GCPF"
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
@@ -49,6 +56,7 @@ enum PackFlags {
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
+	PACK_FILE_COMPRESSED = 1 << 2, // Since format version 3.
 };
 
 class PackSource;
@@ -66,6 +74,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -102,15 +111,20 @@ private:
 
 	PackedDir *root = nullptr;
 
+	// Shared by the files of each pack, invalid if the pack can't be mapped.
+	HashMap<String, Ref<FileMapping>> pack_mappings;
+	Mutex pack_mappings_mutex;
+
 	static PackedData *singleton;
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
+	Ref<FileMapping> _get_pack_mapping(const String &p_pack, const Ref<FileAccess> &p_file);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	HashSet<String> get_file_paths() const;
@@ -162,6 +176,9 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	// Mapping of the whole pack, fetched by the first get_buffer_view() call.
+	mutable Ref<FileMapping> mapping;
+	mutable bool mapping_checked = false;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -183,6 +200,8 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
+	virtual bool read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -229,6 +229,10 @@ int HTTPClientTCP::get_response_code() const {
 	return response_num;
 }
 
+bool HTTPClientTCP::is_response_keep_alive() const {
+	return response_keep_alive;
+}
+
 Error HTTPClientTCP::get_response_headers(List<String> *r_response) {
 	if (!response_headers.size()) {
 		return ERR_INVALID_PARAMETER;
@@ -266,6 +270,7 @@ void HTTPClientTCP::close() {
 	chunk_left = 0;
 	chunk_trailer_part = false;
 	read_until_eof = false;
+	response_keep_alive = true;
 	response_num = 0;
 	handshaking = false;
 }
@@ -500,6 +505,9 @@ Error HTTPClientTCP::poll() {
 					// Not following that specification breaks standard implementations.
 					// Broken web servers should be fixed.
 					bool keep_alive = true;
+					// HTTP/1.0 connections are closed after the response unless asked otherwise.
+					bool http_1_0 = false;
+					bool explicit_keep_alive = false;
 
 					for (int i = 0; i < responses.size(); i++) {
 						String header = responses[i].strip_edges();
@@ -518,16 +526,21 @@ Error HTTPClientTCP::poll() {
 							}
 						} else if (s.begins_with("connection: close")) {
 							keep_alive = false;
+						} else if (s.begins_with("connection:") && s.contains("keep-alive")) {
+							explicit_keep_alive = true;
 						}
 
 						if (i == 0 && responses[i].begins_with("HTTP")) {
 							String num = responses[i].get_slicec(' ', 1);
 							response_num = num.to_int();
+							http_1_0 = responses[i].begins_with("HTTP/1.0");
 						} else {
 							response_headers.push_back(header);
 						}
 					}
 
+					response_keep_alive = keep_alive && (!http_1_0 || explicit_keep_alive);
+
 					// This is a HEAD request, we won't receive anything.
 					if (head_request) {
 						body_size = 0;
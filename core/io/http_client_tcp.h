@@ -61,6 +61,7 @@ private:
 	int64_t body_size = -1;
 	int64_t body_left = 0;
 	bool read_until_eof = false;
+	bool response_keep_alive = true;
 
 	Ref<StreamPeerBuffer> request_buffer;
 	Ref<StreamPeerTCP> tcp_connection;
@@ -89,6 +90,7 @@ public:
 	int get_response_code() const override;
 	Error get_response_headers(List<String> *r_response) override;
 	int64_t get_response_body_length() const override;
+	bool is_response_keep_alive() const override;
 	PackedByteArray read_response_body_chunk() override;
 	void set_blocking_mode(bool p_enable) override;
 	bool is_blocking_mode_enabled() const override;
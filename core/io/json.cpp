@@ -32,6 +32,7 @@
 
 #include "core/config/engine.h"
 #include "core/object/script_language.h"
+#include "core/string/string_builder.h"
 #include "core/variant/container_type_validate.h"
 
 const char *JSON::tk_name[TK_MAX] = {
@@ -47,42 +48,81 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
-}
+// Destination of _stringify(). Pieces are collected in a StringBuilder and joined once, instead of
+// concatenating a new String at every nesting level. When writing to a file, the builder is
+// flushed whenever it grows past FLUSH_SIZE, so the whole document is never held in memory.
+struct JSON::StringifyOutput {
+	static constexpr uint32_t FLUSH_SIZE = 256 * 1024;
+
+	StringBuilder builder;
+	Ref<FileAccess> file;
+
+	_FORCE_INLINE_ void append(const String &p_string) { builder.append(p_string); }
+	_FORCE_INLINE_ void append(const char *p_cstring) { builder.append(p_cstring); }
+
+	// Most strings have nothing to escape, those are appended without being copied.
+	void append_quoted(const String &p_string) {
+		const char32_t *str = p_string.ptr();
+		const int len = p_string.length();
+		int i = 0;
+		while (i < len && str[i] != '"' && str[i] != '\\' && (str[i] > '\r' || str[i] < '\b')) {
+			i++;
+		}
+		builder.append("\"");
+		builder.append(i == len ? p_string : p_string.json_escape());
+		builder.append("\"");
+	}
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
+	_FORCE_INLINE_ void append_indent(const String &p_indent, int p_size) {
+		for (int i = 0; i < p_size; i++) {
+			builder.append(p_indent);
+		}
+	}
 
-	String colon = ":";
-	String end_statement = "";
+	void flush(bool p_force = false) {
+		if (file.is_null() || (!p_force && builder.get_string_length() < FLUSH_SIZE)) {
+			return;
+		}
+		file->store_string(builder.as_string());
+		builder = StringBuilder();
+	}
+};
 
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+void JSON::_stringify(StringifyOutput &r_output, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		r_output.append("...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
+	const char *colon = p_indent.is_empty() ? ":" : ": ";
+	const char *end_statement = p_indent.is_empty() ? "" : "\n";
+
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_output.append("null");
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_output.append(p_var.operator bool() ? "true" : "false");
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_output.append(itos(p_var));
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 
 			// Only for exactly 0. If we have approximately 0 let the user decide how much
 			// precision they want.
 			if (num == double(0)) {
-				return String("0.0");
+				r_output.append("0.0");
+				return;
 			}
 
 			double magnitude = log10(Math::abs(num));
 			int total_digits = p_full_precision ? 17 : 14;
 			int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
 
-			return String::num(num, precision);
+			r_output.append(String::num(num, precision));
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -92,36 +132,47 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.is_empty()) {
-				return "[]";
+				r_output.append("[]");
+				return;
+			}
+			if (p_markers.has(a.id())) {
+				r_output.append("\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
-			String s = "[";
-			s += end_statement;
-
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
 			p_markers.insert(a.id());
 
+			r_output.append("[");
+			r_output.append(end_statement);
+
 			bool first = true;
 			for (const Variant &var : a) {
 				if (first) {
 					first = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_output.append(",");
+					r_output.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_output.append_indent(p_indent, p_cur_indent + 1);
+				_stringify(r_output, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers, p_full_precision);
+				r_output.flush();
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_output.append(end_statement);
+			r_output.append_indent(p_indent, p_cur_indent);
+			r_output.append("]");
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
-			Dictionary d = p_var;
-
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			const Dictionary d = p_var;
+			if (p_markers.has(d.id())) {
+				r_output.append("\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
+			r_output.append("{");
+			r_output.append(end_statement);
+
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
@@ -134,20 +185,25 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_output.append(",");
+					r_output.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_output.append_indent(p_indent, p_cur_indent + 1);
+				r_output.append_quoted(E);
+				r_output.append(colon);
+				_stringify(r_output, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers, p_full_precision);
+				r_output.flush();
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_output.append(end_statement);
+			r_output.append_indent(p_indent, p_cur_indent);
+			r_output.append("}");
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_output.append_quoted(p_var);
+			return;
 	}
 }
 
@@ -196,14 +252,22 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			case '"': {
 				index++;
 				String str;
+				// Plain characters are copied in runs, only escape sequences are appended one by one.
+				int run_start = index;
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
 					} else if (p_str[index] == '"') {
+						if (index > run_start) {
+							str += String(p_str + run_start, index - run_start);
+						}
 						index++;
 						break;
 					} else if (p_str[index] == '\\') {
+						if (index > run_start) {
+							str += String(p_str + run_start, index - run_start);
+						}
 						//escaped characters...
 						index++;
 						char32_t next = p_str[index];
@@ -319,12 +383,10 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
+						run_start = index + 1;
 
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+					} else if (p_str[index] == '\n') {
+						line++;
 					}
 					index++;
 				}
@@ -350,15 +412,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if (is_ascii_alphabet_char(p_str[index])) {
-					String id;
-
+					int id_start = index;
 					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String(p_str + id_start, index - id_start);
 					return OK;
 				} else {
 					r_err_str = "Unexpected character";
@@ -569,10 +629,25 @@ String JSON::get_parsed_text() const {
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	Ref<JSON> json;
-	json.instantiate();
+	StringifyOutput output;
+	HashSet<const void *> markers;
+	_stringify(output, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return output.builder.as_string();
+}
+
+Error JSON::stringify_to_file(const Ref<FileAccess> &p_file, const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	StringifyOutput output;
+	output.file = p_file;
 	HashSet<const void *> markers;
-	return json->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(output, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	output.flush(true);
+
+	if (p_file->get_error() != OK && p_file->get_error() != ERR_FILE_EOF) {
+		return ERR_CANT_CREATE;
+	}
+	return OK;
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -1662,14 +1737,16 @@ Error ResourceFormatSaverJSON::save(const Ref<Resource> &p_resource, const Strin
 	Ref<JSON> json = p_resource;
 	ERR_FAIL_COND_V(json.is_null(), ERR_INVALID_PARAMETER);
 
-	String source = json->get_parsed_text().is_empty() ? JSON::stringify(json->get_data(), "\t", false, true) : json->get_parsed_text();
-
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 
 	ERR_FAIL_COND_V_MSG(err, err, vformat("Cannot save json '%s'.", p_path));
 
-	file->store_string(source);
+	if (json->get_parsed_text().is_empty()) {
+		return JSON::stringify_to_file(file, json->get_data(), "\t", false, true);
+	}
+
+	file->store_string(json->get_parsed_text());
 	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
 	}
@@ -2155,3 +2155,554 @@ Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	}
 	return floats;
 }
+
+////////////
+
+// MarshallSchema values are not padded to 4 bytes like encode_variant() does, to keep
+// small fields small.
+
+static void _schema_put_varint(uint64_t p_value, uint8_t *&r_buf, int &r_len) {
+	do {
+		uint8_t byte = p_value & 0x7F;
+		p_value >>= 7;
+		if (p_value) {
+			byte |= 0x80;
+		}
+		if (r_buf) {
+			*(r_buf++) = byte;
+		}
+		r_len++;
+	} while (p_value);
+}
+
+static Error _schema_get_varint(const uint8_t *&r_buf, int &r_remaining, uint64_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		ERR_FAIL_COND_V(r_remaining < 1, ERR_INVALID_DATA);
+		const uint8_t byte = *(r_buf++);
+		r_remaining--;
+		r_value |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return OK;
+		}
+	}
+	ERR_FAIL_V(ERR_INVALID_DATA);
+}
+
+// Zigzag encoding, so small negative integers also use few bytes.
+static _FORCE_INLINE_ uint64_t _schema_zigzag(int64_t p_value) {
+	return (uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63);
+}
+
+static _FORCE_INLINE_ int64_t _schema_unzigzag(uint64_t p_value) {
+	return int64_t(p_value >> 1) ^ -int64_t(p_value & 1);
+}
+
+static void _schema_put_string(const String &p_string, uint8_t *&r_buf, int &r_len) {
+	const char32_t *str = p_string.ptr();
+	const int len = p_string.length();
+	int ascii_len = 0;
+	while (ascii_len < len && str[ascii_len] < 0x80) {
+		ascii_len++;
+	}
+
+	if (ascii_len == len) {
+		// ASCII is written as is, without allocating a CharString.
+		_schema_put_varint(len, r_buf, r_len);
+		if (r_buf) {
+			for (int i = 0; i < len; i++) {
+				*(r_buf++) = uint8_t(str[i]);
+			}
+		}
+		r_len += len;
+	} else {
+		const CharString utf8 = p_string.utf8();
+		_schema_put_varint(utf8.length(), r_buf, r_len);
+		if (r_buf) {
+			memcpy(r_buf, utf8.get_data(), utf8.length());
+			r_buf += utf8.length();
+		}
+		r_len += utf8.length();
+	}
+}
+
+static Error _schema_get_string(const uint8_t *&r_buf, int &r_remaining, String &r_string) {
+	uint64_t len = 0;
+	Error err = _schema_get_varint(r_buf, r_remaining, len);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(len > uint64_t(r_remaining), ERR_INVALID_DATA);
+
+	if (r_string.parse_utf8((const char *)r_buf, len) != OK) {
+		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid UTF-8 string.");
+	}
+	r_buf += len;
+	r_remaining -= len;
+	return OK;
+}
+
+// Math types are stored as their raw components, `C` being `real_t`, `float` or `int32_t`.
+// Floating-point components are always stored as 32-bit floats, so that builds with
+// different precisions can exchange data.
+template <typename T, typename C>
+static void _schema_put_components(const T &p_value, uint8_t *&r_buf, int &r_len) {
+	static_assert(sizeof(T) % sizeof(C) == 0);
+	constexpr int count = sizeof(T) / sizeof(C);
+	const C *components = reinterpret_cast<const C *>(&p_value);
+
+	for (int i = 0; i < count; i++) {
+		if constexpr (std::is_same_v<C, int32_t>) {
+			_schema_put_varint(_schema_zigzag(components[i]), r_buf, r_len);
+		} else {
+			if (r_buf) {
+				r_buf += encode_float(components[i], r_buf);
+			}
+			r_len += sizeof(float);
+		}
+	}
+}
+
+template <typename T, typename C>
+static Error _schema_get_components(const uint8_t *&r_buf, int &r_remaining, Variant &r_value) {
+	static_assert(sizeof(T) % sizeof(C) == 0);
+	constexpr int count = sizeof(T) / sizeof(C);
+	T value;
+	C *components = reinterpret_cast<C *>(&value);
+
+	for (int i = 0; i < count; i++) {
+		if constexpr (std::is_same_v<C, int32_t>) {
+			uint64_t v = 0;
+			Error err = _schema_get_varint(r_buf, r_remaining, v);
+			ERR_FAIL_COND_V(err != OK, err);
+			components[i] = int32_t(_schema_unzigzag(v));
+		} else {
+			ERR_FAIL_COND_V(r_remaining < int(sizeof(float)), ERR_INVALID_DATA);
+			components[i] = decode_float(r_buf);
+			r_buf += sizeof(float);
+			r_remaining -= sizeof(float);
+		}
+	}
+
+	r_value = value;
+	return OK;
+}
+
+Error MarshallSchema::_encode_value(const Variant &p_value, Variant::Type p_type, Variant::Type p_element_type, const Ref<MarshallSchema> &p_schema, uint8_t *&r_buf, int &r_len, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	if (p_type != Variant::NIL && p_value.get_type() != p_type) {
+		// Convert values of another type, like an int stored in a float field.
+		Variant converted;
+		Callable::CallError ce;
+		const Variant *args[1] = { &p_value };
+		Variant::construct(p_type, converted, args, 1, ce);
+		ERR_FAIL_COND_V_MSG(ce.error != Callable::CallError::CALL_OK, ERR_INVALID_DATA, vformat("Can't encode a value of type %s as %s.", Variant::get_type_name(p_value.get_type()), Variant::get_type_name(p_type)));
+		return _encode_value(converted, p_type, p_element_type, p_schema, r_buf, r_len, p_depth);
+	}
+
+	switch (p_type) {
+		case Variant::BOOL: {
+			if (r_buf) {
+				*(r_buf++) = p_value.operator bool() ? 1 : 0;
+			}
+			r_len++;
+		} break;
+		case Variant::INT: {
+			_schema_put_varint(_schema_zigzag(p_value.operator int64_t()), r_buf, r_len);
+		} break;
+		case Variant::FLOAT: {
+			if (r_buf) {
+				r_buf += encode_double(p_value.operator double(), r_buf);
+			}
+			r_len += sizeof(double);
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			_schema_put_string(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR2: {
+			_schema_put_components<Vector2, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR2I: {
+			_schema_put_components<Vector2i, int32_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::RECT2: {
+			_schema_put_components<Rect2, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::RECT2I: {
+			_schema_put_components<Rect2i, int32_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR3: {
+			_schema_put_components<Vector3, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR3I: {
+			_schema_put_components<Vector3i, int32_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::TRANSFORM2D: {
+			_schema_put_components<Transform2D, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR4: {
+			_schema_put_components<Vector4, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::VECTOR4I: {
+			_schema_put_components<Vector4i, int32_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::PLANE: {
+			_schema_put_components<Plane, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::QUATERNION: {
+			_schema_put_components<Quaternion, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::AABB: {
+			_schema_put_components<AABB, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::BASIS: {
+			_schema_put_components<Basis, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::TRANSFORM3D: {
+			_schema_put_components<Transform3D, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::PROJECTION: {
+			_schema_put_components<Projection, real_t>(p_value, r_buf, r_len);
+		} break;
+		case Variant::COLOR: {
+			_schema_put_components<Color, float>(p_value, r_buf, r_len);
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			const PackedByteArray data = p_value;
+			_schema_put_varint(data.size(), r_buf, r_len);
+			if (r_buf) {
+				memcpy(r_buf, data.ptr(), data.size());
+				r_buf += data.size();
+			}
+			r_len += data.size();
+		} break;
+		case Variant::ARRAY: {
+			// Without an element type, elements are encoded with their type below.
+			if (p_element_type != Variant::NIL) {
+				const Array array = p_value;
+				ERR_FAIL_COND_V_MSG(p_element_type == Variant::DICTIONARY && p_schema.is_valid() && p_schema->fields.is_empty() && array.size() > MAX_EMPTY_RECORDS, ERR_INVALID_DATA,
+						vformat("Can't encode more than %d records without fields.", MAX_EMPTY_RECORDS));
+				_schema_put_varint(array.size(), r_buf, r_len);
+				for (const Variant &element : array) {
+					Error err = _encode_value(element, p_element_type, Variant::NIL, p_schema, r_buf, r_len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+				}
+				break;
+			}
+			[[fallthrough]];
+		}
+		case Variant::DICTIONARY: {
+			if (p_type == Variant::DICTIONARY && p_schema.is_valid()) {
+				return p_schema->_encode_fields(p_value, r_buf, r_len, p_depth + 1);
+			}
+			[[fallthrough]];
+		}
+		default: {
+			// Not worth specializing (or untyped), fall back to encode_variant().
+			int len = 0;
+			Error err = encode_variant(p_value, r_buf, len, false, p_depth + 1);
+			ERR_FAIL_COND_V(err != OK, err);
+			if (r_buf) {
+				r_buf += len;
+			}
+			r_len += len;
+		} break;
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::_decode_value(Variant &r_value, Variant::Type p_type, Variant::Type p_element_type, const Ref<MarshallSchema> &p_schema, const uint8_t *&r_buf, int &r_remaining, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+	switch (p_type) {
+		case Variant::BOOL: {
+			ERR_FAIL_COND_V(r_remaining < 1, ERR_INVALID_DATA);
+			r_value = *(r_buf++) != 0;
+			r_remaining--;
+		} break;
+		case Variant::INT: {
+			uint64_t v = 0;
+			Error err = _schema_get_varint(r_buf, r_remaining, v);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_value = _schema_unzigzag(v);
+		} break;
+		case Variant::FLOAT: {
+			ERR_FAIL_COND_V(r_remaining < int(sizeof(double)), ERR_INVALID_DATA);
+			r_value = decode_double(r_buf);
+			r_buf += sizeof(double);
+			r_remaining -= sizeof(double);
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			String str;
+			Error err = _schema_get_string(r_buf, r_remaining, str);
+			ERR_FAIL_COND_V(err != OK, err);
+			if (p_type == Variant::STRING_NAME) {
+				r_value = StringName(str);
+			} else {
+				r_value = str;
+			}
+		} break;
+		case Variant::VECTOR2: {
+			return _schema_get_components<Vector2, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::VECTOR2I: {
+			return _schema_get_components<Vector2i, int32_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::RECT2: {
+			return _schema_get_components<Rect2, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::RECT2I: {
+			return _schema_get_components<Rect2i, int32_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::VECTOR3: {
+			return _schema_get_components<Vector3, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::VECTOR3I: {
+			return _schema_get_components<Vector3i, int32_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::TRANSFORM2D: {
+			return _schema_get_components<Transform2D, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::VECTOR4: {
+			return _schema_get_components<Vector4, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::VECTOR4I: {
+			return _schema_get_components<Vector4i, int32_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::PLANE: {
+			return _schema_get_components<Plane, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::QUATERNION: {
+			return _schema_get_components<Quaternion, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::AABB: {
+			return _schema_get_components<AABB, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::BASIS: {
+			return _schema_get_components<Basis, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::TRANSFORM3D: {
+			return _schema_get_components<Transform3D, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::PROJECTION: {
+			return _schema_get_components<Projection, real_t>(r_buf, r_remaining, r_value);
+		}
+		case Variant::COLOR: {
+			return _schema_get_components<Color, float>(r_buf, r_remaining, r_value);
+		}
+		case Variant::PACKED_BYTE_ARRAY: {
+			uint64_t size = 0;
+			Error err = _schema_get_varint(r_buf, r_remaining, size);
+			ERR_FAIL_COND_V(err != OK, err);
+			ERR_FAIL_COND_V(size > uint64_t(r_remaining), ERR_INVALID_DATA);
+			PackedByteArray data;
+			data.resize(size);
+			memcpy(data.ptrw(), r_buf, size);
+			r_buf += size;
+			r_remaining -= size;
+			r_value = data;
+		} break;
+		case Variant::ARRAY: {
+			if (p_element_type != Variant::NIL) {
+				uint64_t size = 0;
+				Error err = _schema_get_varint(r_buf, r_remaining, size);
+				ERR_FAIL_COND_V(err != OK, err);
+				// Every element takes at least one byte, except for records without fields.
+				const bool empty_elements = p_element_type == Variant::DICTIONARY && p_schema.is_valid() && p_schema->fields.is_empty();
+				ERR_FAIL_COND_V(size > (empty_elements ? uint64_t(MAX_EMPTY_RECORDS) : uint64_t(r_remaining)), ERR_INVALID_DATA);
+
+				Array array;
+				if (p_element_type != Variant::OBJECT) {
+					array.set_typed(p_element_type, StringName(), Variant());
+				}
+				array.resize(size);
+				for (uint64_t i = 0; i < size; i++) {
+					Variant element;
+					err = _decode_value(element, p_element_type, Variant::NIL, p_schema, r_buf, r_remaining, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					array.set(i, element);
+				}
+				r_value = array;
+				break;
+			}
+			[[fallthrough]];
+		}
+		case Variant::DICTIONARY: {
+			if (p_type == Variant::DICTIONARY && p_schema.is_valid()) {
+				Dictionary dict;
+				Error err = p_schema->_decode_fields(dict, r_buf, r_remaining, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				r_value = dict;
+				break;
+			}
+			[[fallthrough]];
+		}
+		default: {
+			int len = 0;
+			Error err = decode_variant(r_value, r_buf, r_remaining, &len, false, p_depth + 1);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_buf += len;
+			r_remaining -= len;
+		} break;
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::_encode_fields(const Dictionary &p_data, uint8_t *&r_buf, int &r_len, int p_depth) const {
+	for (const Field &field : fields) {
+		const Variant *value = p_data.getptr(field.key);
+		ERR_FAIL_NULL_V_MSG(value, ERR_INVALID_DATA, vformat("Can't encode Dictionary, missing field '%s'.", field.name));
+		Error err = _encode_value(*value, field.type, field.element_type, field.schema, r_buf, r_len, p_depth);
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
+Error MarshallSchema::_decode_fields(Dictionary &r_data, const uint8_t *&r_buf, int &r_remaining, int p_depth) const {
+	for (const Field &field : fields) {
+		Variant value;
+		Error err = _decode_value(value, field.type, field.element_type, field.schema, r_buf, r_remaining, p_depth);
+		ERR_FAIL_COND_V(err != OK, err);
+		r_data[field.key] = value;
+	}
+	return OK;
+}
+
+void MarshallSchema::add_field(const StringName &p_name, Variant::Type p_type, Variant::Type p_element_type, const Ref<MarshallSchema> &p_schema) {
+	ERR_FAIL_COND(p_name.is_empty());
+	ERR_FAIL_INDEX(p_type, Variant::VARIANT_MAX);
+	ERR_FAIL_INDEX(p_element_type, Variant::VARIANT_MAX);
+	ERR_FAIL_COND_MSG(p_element_type == Variant::ARRAY, "Arrays of arrays must use an untyped element type.");
+	ERR_FAIL_COND_MSG(p_schema.is_valid() && p_schema->_contains(this), "A schema can't contain itself.");
+	for (const Field &field : fields) {
+		ERR_FAIL_COND_MSG(field.name == p_name, vformat("Field '%s' already exists.", p_name));
+	}
+
+	Field field;
+	field.name = p_name;
+	field.key = String(p_name);
+	field.type = p_type;
+	field.element_type = p_type == Variant::ARRAY ? p_element_type : Variant::NIL;
+	field.schema = p_schema;
+	fields.push_back(field);
+}
+
+bool MarshallSchema::_contains(const MarshallSchema *p_schema) const {
+	if (p_schema == this) {
+		return true;
+	}
+	// add_field() keeps schemas acyclic, so this always terminates.
+	for (const Field &field : fields) {
+		if (field.schema.is_valid() && field.schema->_contains(p_schema)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int MarshallSchema::get_field_count() const {
+	return fields.size();
+}
+
+StringName MarshallSchema::get_field_name(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, (int)fields.size(), StringName());
+	return fields[p_index].name;
+}
+
+Variant::Type MarshallSchema::get_field_type(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, (int)fields.size(), Variant::NIL);
+	return fields[p_index].type;
+}
+
+void MarshallSchema::clear() {
+	fields.clear();
+}
+
+Ref<MarshallSchema> MarshallSchema::from_template(const Dictionary &p_template) {
+	Ref<MarshallSchema> schema;
+	schema.instantiate();
+
+	List<Variant> keys;
+	p_template.get_key_list(&keys);
+	for (const Variant &key : keys) {
+		ERR_CONTINUE_MSG(!key.is_string(), "Schema templates can only have String keys.");
+		const Variant &value = p_template[key];
+
+		Variant::Type element_type = Variant::NIL;
+		Ref<MarshallSchema> sub_schema;
+		if (value.get_type() == Variant::DICTIONARY) {
+			const Dictionary dict = value;
+			if (!dict.is_empty()) {
+				sub_schema = from_template(dict);
+			}
+		} else if (value.get_type() == Variant::ARRAY) {
+			const Array array = value;
+			if (array.is_typed()) {
+				element_type = Variant::Type(array.get_typed_builtin());
+			} else if (!array.is_empty() && array[0].get_type() == Variant::DICTIONARY) {
+				// An array of records.
+				element_type = Variant::DICTIONARY;
+			}
+			if (element_type == Variant::DICTIONARY && !array.is_empty() && array[0].get_type() == Variant::DICTIONARY) {
+				sub_schema = from_template(array[0]);
+			} else if (element_type == Variant::ARRAY) {
+				element_type = Variant::NIL;
+			}
+		}
+
+		schema->add_field(key, value.get_type(), element_type, sub_schema);
+	}
+
+	return schema;
+}
+
+Error MarshallSchema::encode(const Dictionary &p_data, uint8_t *r_buffer, int &r_len) const {
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+	return _encode_fields(p_data, buf, r_len, 0);
+}
+
+Error MarshallSchema::decode(const uint8_t *p_buffer, int p_len, Dictionary &r_data, int *r_len) const {
+	const uint8_t *buf = p_buffer;
+	int remaining = p_len;
+	Error err = _decode_fields(r_data, buf, remaining, 0);
+	if (err == OK && r_len) {
+		*r_len = p_len - remaining;
+	}
+	return err;
+}
+
+PackedByteArray MarshallSchema::_encode_bind(const Dictionary &p_data) const {
+	int len = 0;
+	Error err = encode(p_data, nullptr, len);
+	ERR_FAIL_COND_V(err != OK, PackedByteArray());
+
+	PackedByteArray data;
+	data.resize(len);
+	err = encode(p_data, data.ptrw(), len);
+	ERR_FAIL_COND_V(err != OK, PackedByteArray());
+	return data;
+}
+
+Dictionary MarshallSchema::_decode_bind(const PackedByteArray &p_buffer) const {
+	Dictionary data;
+	Error err = decode(p_buffer.ptr(), p_buffer.size(), data);
+	ERR_FAIL_COND_V(err != OK, Dictionary());
+	return data;
+}
+
+void MarshallSchema::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_field", "name", "type", "element_type", "schema"), &MarshallSchema::add_field, DEFVAL(Variant::NIL), DEFVAL(Ref<MarshallSchema>()));
+	ClassDB::bind_method(D_METHOD("get_field_count"), &MarshallSchema::get_field_count);
+	ClassDB::bind_method(D_METHOD("get_field_name", "index"), &MarshallSchema::get_field_name);
+	ClassDB::bind_method(D_METHOD("get_field_type", "index"), &MarshallSchema::get_field_type);
+	ClassDB::bind_method(D_METHOD("clear"), &MarshallSchema::clear);
+
+	ClassDB::bind_static_method("MarshallSchema", D_METHOD("from_template", "template"), &MarshallSchema::from_template);
+
+	ClassDB::bind_method(D_METHOD("encode", "data"), &MarshallSchema::_encode_bind);
+	ClassDB::bind_method(D_METHOD("decode", "bytes"), &MarshallSchema::_decode_bind);
+}
@@ -32,6 +32,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 #include "core/variant/variant.h"
 
@@ -221,6 +222,53 @@ public:
 	EncodedObjectAsID() {}
 };
 
+// Fixed layout for Dictionaries of a known shape. Field names and types are stored in the
+// schema instead of the payload, integers are varint encoded, and decoded keys are shared
+// with the schema, so encoding and decoding are much cheaper than encode_variant()/decode_variant().
+class MarshallSchema : public RefCounted {
+	GDCLASS(MarshallSchema, RefCounted);
+
+	struct Field {
+		StringName name;
+		Variant key; // Dictionary key, as a String like decode_variant() produces.
+		Variant::Type type = Variant::NIL;
+		Variant::Type element_type = Variant::NIL;
+		Ref<MarshallSchema> schema;
+	};
+
+	LocalVector<Field> fields;
+
+	bool _contains(const MarshallSchema *p_schema) const;
+
+	static Error _encode_value(const Variant &p_value, Variant::Type p_type, Variant::Type p_element_type, const Ref<MarshallSchema> &p_schema, uint8_t *&r_buf, int &r_len, int p_depth);
+	static Error _decode_value(Variant &r_value, Variant::Type p_type, Variant::Type p_element_type, const Ref<MarshallSchema> &p_schema, const uint8_t *&r_buf, int &r_remaining, int p_depth);
+
+	Error _encode_fields(const Dictionary &p_data, uint8_t *&r_buf, int &r_len, int p_depth) const;
+	Error _decode_fields(Dictionary &r_data, const uint8_t *&r_buf, int &r_remaining, int p_depth) const;
+
+	PackedByteArray _encode_bind(const Dictionary &p_data) const;
+	Dictionary _decode_bind(const PackedByteArray &p_buffer) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	// Records without fields take no space, so arrays of them are limited to this size.
+	static constexpr int MAX_EMPTY_RECORDS = 1 << 16;
+
+	void add_field(const StringName &p_name, Variant::Type p_type, Variant::Type p_element_type = Variant::NIL, const Ref<MarshallSchema> &p_schema = Ref<MarshallSchema>());
+	int get_field_count() const;
+	StringName get_field_name(int p_index) const;
+	Variant::Type get_field_type(int p_index) const;
+	void clear();
+
+	static Ref<MarshallSchema> from_template(const Dictionary &p_template);
+
+	// Like encode_variant(), `r_buffer` may be null to only compute the length.
+	Error encode(const Dictionary &p_data, uint8_t *r_buffer, int &r_len) const;
+	Error decode(const uint8_t *p_buffer, int p_len, Dictionary &r_data, int *r_len = nullptr) const;
+};
+
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
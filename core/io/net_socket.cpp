@@ -40,3 +40,33 @@ NetSocket *NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return nullptr;
 }
+
+Error NetSocket::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	r_received = 0;
+	for (int i = 0; i < p_count; i++) {
+		Datagram &datagram = p_datagrams[i];
+		int read = 0;
+		Error err = recvfrom(datagram.buffer, datagram.size, read, datagram.ip, datagram.port);
+		if (err != OK) {
+			// Only report the error if nothing was received.
+			return r_received ? OK : err;
+		}
+		datagram.size = read;
+		r_received++;
+	}
+	return OK;
+}
+
+Error NetSocket::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	r_sent = 0;
+	for (int i = 0; i < p_count; i++) {
+		const Datagram &datagram = p_datagrams[i];
+		int sent = 0;
+		Error err = sendto(datagram.buffer, datagram.size, sent, datagram.ip, datagram.port);
+		if (err != OK) {
+			return r_sent ? OK : err;
+		}
+		r_sent++;
+	}
+	return OK;
+}
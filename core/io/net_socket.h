@@ -52,6 +52,13 @@ public:
 		TYPE_UDP,
 	};
 
+	struct Datagram {
+		uint8_t *buffer = nullptr;
+		int size = 0; // When receiving, the buffer capacity, then the amount of bytes read.
+		IPAddress ip;
+		uint16_t port = 0;
+	};
+
 	virtual Error open(Type p_type, IP::Type &ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(IPAddress p_addr, uint16_t p_port) = 0;
@@ -64,6 +71,11 @@ public:
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) = 0;
 
+	// Batched versions of recvfrom/sendto, which may process fewer than p_count datagrams.
+	// The default implementation loops, platforms can override them to reduce the syscalls.
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
+
 	virtual bool is_open() const = 0;
 	virtual int get_available_bytes() const = 0;
 	virtual Error get_socket_address(IPAddress *r_ip, uint16_t *r_port) const = 0;
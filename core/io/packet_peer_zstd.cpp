@@ -0,0 +1,251 @@
+/**************************************************************************/
+/*  packet_peer_zstd.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "core/io/packet_peer_zstd.h"
+
+// Needed for magicless frames, only defined globally when building the bundled zstd.
+#ifndef ZSTD_STATIC_LINKING_ONLY
+#define ZSTD_STATIC_LINKING_ONLY
+#endif
+#include <zstd.h>
+
+void PacketPeerZSTD::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_packet_peer", "peer"), &PacketPeerZSTD::set_packet_peer);
+	ClassDB::bind_method(D_METHOD("get_packet_peer"), &PacketPeerZSTD::get_packet_peer);
+	ClassDB::bind_method(D_METHOD("set_dictionary", "dictionary"), &PacketPeerZSTD::set_dictionary);
+	ClassDB::bind_method(D_METHOD("get_dictionary"), &PacketPeerZSTD::get_dictionary);
+	ClassDB::bind_method(D_METHOD("set_compression_level", "level"), &PacketPeerZSTD::set_compression_level);
+	ClassDB::bind_method(D_METHOD("get_compression_level"), &PacketPeerZSTD::get_compression_level);
+	ClassDB::bind_method(D_METHOD("set_streaming", "enable"), &PacketPeerZSTD::set_streaming);
+	ClassDB::bind_method(D_METHOD("is_streaming"), &PacketPeerZSTD::is_streaming);
+	ClassDB::bind_method(D_METHOD("clear"), &PacketPeerZSTD::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "packet_peer", PROPERTY_HINT_RESOURCE_TYPE, "PacketPeer", PROPERTY_USAGE_NONE), "set_packet_peer", "get_packet_peer");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "dictionary"), "set_dictionary", "get_dictionary");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "compression_level", PROPERTY_HINT_RANGE, "1,22,1"), "set_compression_level", "get_compression_level");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "streaming"), "set_streaming", "is_streaming");
+}
+
+PacketPeerZSTD::~PacketPeerZSTD() {
+	_close();
+}
+
+void PacketPeerZSTD::_close() {
+	ZSTD_freeCCtx((ZSTD_CCtx *)cctx);
+	ZSTD_freeDCtx((ZSTD_DCtx *)dctx);
+	ZSTD_freeCDict((ZSTD_CDict *)cdict);
+	ZSTD_freeDDict((ZSTD_DDict *)ddict);
+	cctx = nullptr;
+	dctx = nullptr;
+	cdict = nullptr;
+	ddict = nullptr;
+}
+
+Error PacketPeerZSTD::_init_contexts() {
+	if (cctx) {
+		return OK;
+	}
+
+	ZSTD_CCtx *c = ZSTD_createCCtx();
+	ZSTD_DCtx *d = ZSTD_createDCtx();
+	cctx = c;
+	dctx = d;
+	if (!c || !d) {
+		_close();
+		ERR_FAIL_V(ERR_OUT_OF_MEMORY);
+	}
+
+	// Packets are small, avoid spending bytes on the frame magic number, dictionary ID and content size.
+	ZSTD_CCtx_setParameter(c, ZSTD_c_compressionLevel, compression_level);
+	ZSTD_CCtx_setParameter(c, ZSTD_c_format, ZSTD_f_zstd1_magicless);
+	ZSTD_CCtx_setParameter(c, ZSTD_c_dictIDFlag, 0);
+	ZSTD_CCtx_setParameter(c, ZSTD_c_contentSizeFlag, 0);
+	ZSTD_DCtx_setParameter(d, ZSTD_d_format, ZSTD_f_zstd1_magicless);
+
+	if (!dictionary.is_empty()) {
+		// The digested dictionaries are kept for the lifetime of the contexts, so they are loaded only once.
+		cdict = ZSTD_createCDict(dictionary.ptr(), dictionary.size(), compression_level);
+		ddict = ZSTD_createDDict(dictionary.ptr(), dictionary.size());
+		if (!cdict || !ddict) {
+			_close();
+			ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid dictionary.");
+		}
+		ZSTD_CCtx_refCDict(c, (ZSTD_CDict *)cdict);
+		ZSTD_DCtx_refDDict(d, (ZSTD_DDict *)ddict);
+	}
+	return OK;
+}
+
+void PacketPeerZSTD::clear() {
+	_close();
+	compress_buffer.reset();
+	decompress_buffer.reset();
+}
+
+int PacketPeerZSTD::get_available_packet_count() const {
+	ERR_FAIL_COND_V(peer.is_null(), 0);
+	return peer->get_available_packet_count();
+}
+
+Error PacketPeerZSTD::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
+	ERR_FAIL_COND_V(peer.is_null(), ERR_UNCONFIGURED);
+
+	const uint8_t *packet = nullptr;
+	int packet_size = 0;
+	Error err = peer->get_packet(&packet, packet_size);
+	if (err != OK) {
+		return err;
+	}
+	ERR_FAIL_COND_V_MSG(packet_size < 1, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+
+	if (packet[0] == PACKET_RAW) {
+		*r_buffer = packet + 1;
+		r_buffer_size = packet_size - 1;
+		return OK;
+	}
+	ERR_FAIL_COND_V_MSG(packet[0] != PACKET_COMPRESSED, ERR_INVALID_DATA, "Invalid packet received. Unknown packet type.");
+
+	err = _init_contexts();
+	ERR_FAIL_COND_V(err != OK, err);
+
+	ZSTD_DCtx *d = (ZSTD_DCtx *)dctx;
+	if (!streaming) {
+		ZSTD_DCtx_reset(d, ZSTD_reset_session_only);
+	}
+	if (decompress_buffer.size() < 1024) {
+		decompress_buffer.resize(1024);
+	}
+
+	ZSTD_inBuffer in = { packet + 1, (size_t)packet_size - 1, 0 };
+	ZSTD_outBuffer out = { decompress_buffer.ptr(), decompress_buffer.size(), 0 };
+	while (true) {
+		size_t ret = ZSTD_decompressStream(d, &out, &in);
+		ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), ERR_INVALID_DATA, vformat("Invalid packet received. Decompression failed: %s.", ZSTD_getErrorName(ret)));
+		if (ret == 0 || (in.pos == in.size && out.pos < out.size)) {
+			// Frame complete, or everything received so far was flushed when streaming.
+			ERR_FAIL_COND_V_MSG(!streaming && ret != 0, ERR_INVALID_DATA, "Invalid packet received. Truncated frame.");
+			break;
+		}
+		// Output buffer is full, there might be more data.
+		ERR_FAIL_COND_V_MSG(out.size >= MAX_DECOMPRESSED_SIZE, ERR_OUT_OF_MEMORY, "Invalid packet received. Decompressed size too big.");
+		decompress_buffer.resize(out.size * 2);
+		out.dst = decompress_buffer.ptr();
+		out.size = decompress_buffer.size();
+	}
+
+	*r_buffer = decompress_buffer.ptr();
+	r_buffer_size = out.pos;
+	return OK;
+}
+
+Error PacketPeerZSTD::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
+	ERR_FAIL_COND_V(peer.is_null(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_buffer_size < 0, ERR_INVALID_PARAMETER);
+
+	Error err = _init_contexts();
+	ERR_FAIL_COND_V(err != OK, err);
+
+	ZSTD_CCtx *c = (ZSTD_CCtx *)cctx;
+	if (!streaming) {
+		ZSTD_CCtx_reset(c, ZSTD_reset_session_only);
+	}
+	const uint32_t bound = ZSTD_compressBound(p_buffer_size) + 1;
+	if (compress_buffer.size() < bound) {
+		compress_buffer.resize(bound);
+	}
+
+	// When streaming, the frame is never ended and each packet is a flushed block, so the history of previous packets is used as context.
+	const ZSTD_EndDirective directive = streaming ? ZSTD_e_flush : ZSTD_e_end;
+	ZSTD_inBuffer in = { p_buffer, (size_t)p_buffer_size, 0 };
+	ZSTD_outBuffer out = { compress_buffer.ptr() + 1, compress_buffer.size() - 1, 0 };
+	while (true) {
+		size_t ret = ZSTD_compressStream2(c, &out, &in, directive);
+		ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), FAILED, vformat("Compression failed: %s.", ZSTD_getErrorName(ret)));
+		if (ret == 0) {
+			break;
+		}
+		compress_buffer.resize(compress_buffer.size() * 2);
+		out.dst = compress_buffer.ptr() + 1;
+		out.size = compress_buffer.size() - 1;
+	}
+
+	if (!streaming && out.pos >= (size_t)p_buffer_size) {
+		// Not worth it. Streamed packets can't be skipped, the decompressor must see them all.
+		memcpy(compress_buffer.ptr() + 1, p_buffer, p_buffer_size);
+		compress_buffer[0] = PACKET_RAW;
+		return peer->put_packet(compress_buffer.ptr(), p_buffer_size + 1);
+	}
+
+	compress_buffer[0] = PACKET_COMPRESSED;
+	return peer->put_packet(compress_buffer.ptr(), out.pos + 1);
+}
+
+int PacketPeerZSTD::get_max_packet_size() const {
+	ERR_FAIL_COND_V(peer.is_null(), 0);
+	return MIN(peer->get_max_packet_size() - 1, (int)MAX_DECOMPRESSED_SIZE);
+}
+
+void PacketPeerZSTD::set_packet_peer(const Ref<PacketPeer> &p_peer) {
+	ERR_FAIL_COND(p_peer.ptr() == this);
+	peer = p_peer;
+	clear();
+}
+
+Ref<PacketPeer> PacketPeerZSTD::get_packet_peer() const {
+	return peer;
+}
+
+void PacketPeerZSTD::set_dictionary(const Vector<uint8_t> &p_dictionary) {
+	dictionary = p_dictionary;
+	clear();
+}
+
+Vector<uint8_t> PacketPeerZSTD::get_dictionary() const {
+	return dictionary;
+}
+
+void PacketPeerZSTD::set_compression_level(int p_level) {
+	ERR_FAIL_COND(p_level < 1 || p_level > ZSTD_maxCLevel());
+	compression_level = p_level;
+	clear();
+}
+
+int PacketPeerZSTD::get_compression_level() const {
+	return compression_level;
+}
+
+void PacketPeerZSTD::set_streaming(bool p_enable) {
+	streaming = p_enable;
+	clear();
+}
+
+bool PacketPeerZSTD::is_streaming() const {
+	return streaming;
+}
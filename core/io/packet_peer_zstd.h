@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  packet_peer_zstd.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/packet_peer.h"
+#include "core/templates/local_vector.h"
+
+class PacketPeerZSTD : public PacketPeer {
+	GDCLASS(PacketPeerZSTD, PacketPeer);
+
+	enum {
+		PACKET_RAW = 0,
+		PACKET_COMPRESSED = 1,
+		MAX_DECOMPRESSED_SIZE = 1 << 24,
+	};
+
+	Ref<PacketPeer> peer;
+
+	// Will hold our ZSTD_CCtx, ZSTD_DCtx, ZSTD_CDict and ZSTD_DDict instances.
+	void *cctx = nullptr;
+	void *dctx = nullptr;
+	void *cdict = nullptr;
+	void *ddict = nullptr;
+
+	Vector<uint8_t> dictionary;
+	int compression_level = 3;
+	bool streaming = false;
+
+	LocalVector<uint8_t> compress_buffer;
+	LocalVector<uint8_t> decompress_buffer;
+
+	Error _init_contexts();
+	void _close();
+
+protected:
+	static void _bind_methods();
+
+public:
+	virtual int get_available_packet_count() const override;
+	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override;
+	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override;
+
+	virtual int get_max_packet_size() const override;
+
+	void set_packet_peer(const Ref<PacketPeer> &p_peer);
+	Ref<PacketPeer> get_packet_peer() const;
+
+	void set_dictionary(const Vector<uint8_t> &p_dictionary);
+	Vector<uint8_t> get_dictionary() const;
+
+	void set_compression_level(int p_level);
+	int get_compression_level() const;
+
+	void set_streaming(bool p_enable);
+	bool is_streaming() const;
+
+	void clear();
+
+	PacketPeerZSTD() {}
+	~PacketPeerZSTD();
+};
@@ -32,6 +32,7 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
@@ -49,6 +50,7 @@ static int _get_pad(int p_alignment, int p_n) {
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file_compressed", "target_path", "source_path", "encrypt"), &PCKPacker::add_file_compressed, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
@@ -90,7 +92,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	alignment = p_alignment;
 
 	file->store_32(PACK_HEADER_MAGIC);
-	file->store_32(PACK_FORMAT_VERSION);
+	file->store_32(PACK_FORMAT_VERSION_UNCOMPRESSED); // Raised by flush() if a file is compressed.
 	file->store_32(VERSION_MAJOR);
 	file->store_32(VERSION_MINOR);
 	file->store_32(VERSION_PATCH);
@@ -127,6 +129,14 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 }
 
 Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+	return _add_file(p_target_path, p_source_path, p_encrypt, false);
+}
+
+Error PCKPacker::add_file_compressed(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+	return _add_file(p_target_path, p_source_path, p_encrypt, true);
+}
+
+Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_source_path, FileAccess::READ);
@@ -153,7 +163,17 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	}
 	pf.encrypted = p_encrypt;
 
-	uint64_t _size = pf.size;
+	if (p_compress && data.size() <= UINT32_MAX) {
+		Vector<uint8_t> blocks = FileAccessCompressed::compress_blocks(data.ptr(), data.size(), Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+		// Incompressible files are stored as is.
+		if (!blocks.is_empty() && blocks.size() + 4 < data.size()) {
+			pf.compressed_data.resize(4);
+			memcpy(pf.compressed_data.ptrw(), PACK_COMPRESSED_MAGIC, 4);
+			pf.compressed_data.append_array(blocks);
+		}
+	}
+
+	uint64_t _size = pf.compressed_data.is_empty() ? pf.size : pf.compressed_data.size();
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
 			_size += 16 - (_size % 16);
@@ -174,6 +194,16 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	for (int i = 0; i < files.size(); i++) {
+		if (!files[i].compressed_data.is_empty()) {
+			const uint64_t pos = file->get_position();
+			file->seek(4); // After the magic.
+			file->store_32(PACK_FORMAT_VERSION);
+			file->seek(pos);
+			break;
+		}
+	}
+
 	int64_t file_base_ofs = file->get_position();
 	file->store_64(0); // files base
 
@@ -219,6 +249,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (!files[i].compressed_data.is_empty()) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -259,6 +292,11 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
+		if (!files[i].compressed_data.is_empty()) {
+			ftmp->store_buffer(files[i].compressed_data);
+			to_write = 0;
+		}
+
 		while (to_write > 0) {
 			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
 			ftmp->store_buffer(buf, read);
@@ -54,12 +54,17 @@ class PCKPacker : public RefCounted {
 		bool encrypted = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
+		// Stored instead of the source file when compressing made it smaller.
+		Vector<uint8_t> compressed_data;
 	};
 	Vector<File> files;
 
+	Error _add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt, bool p_compress);
+
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
+	Error add_file_compressed(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
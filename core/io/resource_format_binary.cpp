@@ -33,8 +33,11 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
+#include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -398,6 +401,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				} break;
 				case OBJECT_INTERNAL_RESOURCE: {
 					uint32_t index = f->get_32();
+					if (decoding) {
+						deferred_reference = true;
+						break;
+					}
 					String path;
 
 					if (using_named_scene_ids) { // New format.
@@ -420,6 +427,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 					String exttype = get_unicode_string();
 					String path = get_unicode_string();
+					if (decoding) {
+						deferred_reference = true;
+						break;
+					}
 
 					if (!path.contains("://") && path.is_relative_path()) {
 						// path is relative to file being loaded, so convert to a resource path
@@ -441,6 +452,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				case OBJECT_EXTERNAL_RESOURCE_INDEX: {
 					//new file format, just refers to an index in the external list
 					int erindex = f->get_32();
+					if (decoding) {
+						deferred_reference = true;
+						break;
+					}
 
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
@@ -674,6 +689,210 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	return OK; //never reach anyway
 }
 
+// Larger files are left to stream in as they are parsed.
+static constexpr uint64_t PREFETCH_MAX_SIZE = 64 * 1024 * 1024;
+// Fewer resources aren't worth handing to worker threads.
+static constexpr int DECODE_MIN_RESOURCES = 16;
+
+void ResourceLoaderBinary::_prefetch_callback(void *p_userdata, int64_t p_read) {
+	ResourceLoaderBinary *loader = (ResourceLoaderBinary *)p_userdata;
+	loader->prefetch_read = p_read;
+	loader->prefetch_semaphore.post();
+}
+
+void ResourceLoaderBinary::_prefetch_dependency_callback(void *p_userdata, int64_t p_read) {
+	((Semaphore *)p_userdata)->post();
+}
+
+void ResourceLoaderBinary::_prefetch_dependencies_task(void *p_userdata) {
+	Vector<String> *paths = (Vector<String> *)p_userdata;
+
+	ResourceFormatImporter *importer = ResourceFormatImporter::get_singleton();
+	LocalVector<Ref<FileAccess>> dependencies;
+	Semaphore done;
+	for (const String &path : *paths) {
+		String file_path = path;
+		if (importer && importer->recognize_path(file_path)) {
+			file_path = importer->get_internal_resource_path(file_path);
+		}
+		Ref<FileAccess> dependency = FileAccess::open(file_path, FileAccess::READ);
+		if (dependency.is_null()) {
+			continue;
+		}
+		if (dependency->read_async(0, nullptr, dependency->get_length(), &_prefetch_dependency_callback, &done)) {
+			dependencies.push_back(dependency);
+		}
+	}
+
+	// Prefetching only issues read-ahead advice, so this is short. The files
+	// must stay open until then, and are closed here rather than on the I/O thread.
+	for (uint32_t i = 0; i < dependencies.size(); i++) {
+		done.wait();
+	}
+	memdelete(paths);
+}
+
+void ResourceLoaderBinary::_start_prefetch() {
+	if (external_resources.is_empty()) {
+		// Nothing to overlap the read with.
+		return;
+	}
+
+	uint64_t length = f->get_length();
+	if (!internal_resources.is_empty() && length <= PREFETCH_MAX_SIZE) {
+		prefetch_buffer.resize(length);
+		prefetch_pending = f->read_async(0, prefetch_buffer.ptrw(), length, &_prefetch_callback, this);
+		if (!prefetch_pending) {
+			prefetch_buffer.clear();
+		}
+	}
+
+	// Dependencies load one after the other unless using sub-threads, have the OS read them all ahead meanwhile.
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (!pool || pool->get_thread_count() == 0) {
+		return;
+	}
+	Vector<String> *paths = memnew(Vector<String>);
+	for (const ExtResource &er : external_resources) {
+		if (!ResourceCache::has(er.path)) {
+			paths->push_back(er.path);
+		}
+	}
+	if (paths->is_empty()) {
+		memdelete(paths);
+		return;
+	}
+	dependency_prefetch_task = pool->add_native_task(&_prefetch_dependencies_task, paths, false, "ResourceLoaderBinary prefetch");
+}
+
+void ResourceLoaderBinary::_finish_prefetch() {
+	if (dependency_prefetch_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// Long done by now, the dependencies were loaded meanwhile.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependency_prefetch_task);
+		dependency_prefetch_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	if (!prefetch_pending) {
+		return;
+	}
+
+	prefetch_semaphore.wait();
+	prefetch_pending = false;
+	if (prefetch_read != prefetch_buffer.size()) {
+		// Keep reading from the file.
+		prefetch_buffer.clear();
+		return;
+	}
+
+	f = _open_prefetch_buffer();
+}
+
+Ref<FileAccess> ResourceLoaderBinary::_open_prefetch_buffer() const {
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(prefetch_buffer.ptr(), prefetch_buffer.size());
+	fm->set_big_endian(f->big_endian);
+	fm->real_is_double = f->real_is_double;
+	return fm;
+}
+
+#ifdef TESTS_ENABLED
+SafeNumeric<uint64_t> ResourceLoaderBinary::parallel_decode_count;
+bool ResourceLoaderBinary::parallel_decode_disabled = false;
+#endif
+
+void ResourceLoaderBinary::_decode_resources_task(void *p_userdata) {
+	((ResourceLoaderBinary *)p_userdata)->_decode_pending_resources();
+}
+
+void ResourceLoaderBinary::_decode_pending_resources() {
+	for (uint32_t i = decode_next.postincrement(); i < decoded_resources.size(); i = decode_next.postincrement()) {
+		_decode_resource(i);
+	}
+}
+
+void ResourceLoaderBinary::_decode_resource(uint32_t p_index) {
+	// Own reader, sharing only what parsing values needs.
+	ResourceLoaderBinary decoder;
+	decoder.f = _open_prefetch_buffer();
+	decoder.string_map = string_map;
+	decoder.ver_format = ver_format;
+	decoder.local_path = local_path;
+	decoder.decoding = true;
+
+	DecodedResource &decoded = decoded_resources[p_index];
+	decoder.f->seek(internal_resources[p_index].offset);
+	decoded.type = decoder.get_unicode_string();
+
+	uint32_t pc = decoder.f->get_32();
+	for (uint32_t j = 0; j < pc; j++) {
+		DecodedProperty property;
+		property.name = decoder._get_string();
+		if (property.name == StringName() || decoder.f->eof_reached()) {
+			// Loading reports it.
+			return;
+		}
+
+		uint64_t offset = decoder.f->get_position();
+		decoder.deferred_reference = false;
+		if (decoder.parse_variant(property.value) != OK) {
+			return;
+		}
+		if (decoder.deferred_reference) {
+			property.value = Variant();
+			property.deferred_offset = offset;
+		}
+		decoded.properties.push_back(property);
+	}
+	decoded.error = OK;
+}
+
+void ResourceLoaderBinary::_decode_resources() {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (internal_resources.size() < DECODE_MIN_RESOURCES || !pool || pool->get_thread_count() <= 1) {
+		return;
+	}
+#ifdef TESTS_ENABLED
+	if (parallel_decode_disabled) {
+		return;
+	}
+#endif
+
+	if (prefetch_buffer.is_empty()) {
+		uint64_t length = f->get_length();
+		if (length > PREFETCH_MAX_SIZE) {
+			return;
+		}
+		prefetch_buffer.resize(length);
+		f->seek(0);
+		if (f->get_buffer(prefetch_buffer.ptrw(), length) != length) {
+			prefetch_buffer.clear();
+			return;
+		}
+		f = _open_prefetch_buffer();
+	}
+
+	decoded_resources.resize(internal_resources.size());
+	decode_next.set(0);
+
+	// Threaded loads run on worker threads, which block when waiting on a group
+	// but keep running other tasks when waiting on a task. So use plain tasks,
+	// and have this thread decode its share too.
+	const uint32_t task_count = MIN((uint32_t)pool->get_thread_count(), decoded_resources.size()) - 1;
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	tasks.reserve(task_count);
+	for (uint32_t i = 0; i < task_count; i++) {
+		tasks.push_back(pool->add_native_task(&_decode_resources_task, this, true, "ResourceLoaderBinary"));
+	}
+	_decode_pending_resources();
+	for (WorkerThreadPool::TaskID task : tasks) {
+		pool->wait_for_task_completion(task);
+	}
+#ifdef TESTS_ENABLED
+	parallel_decode_count.increment();
+#endif
+}
+
 Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
@@ -696,6 +915,12 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	}
+
+	_start_prefetch();
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
 		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
 		if (external_resources[i].load_token.is_null()) {
 			if (!ResourceLoader::get_abort_on_missing_resources()) {
@@ -707,6 +932,9 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	_finish_prefetch();
+	_decode_resources();
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -740,11 +968,18 @@ Error ResourceLoaderBinary::load() {
 			}
 		}
 
-		uint64_t offset = internal_resources[i].offset;
-
-		f->seek(offset);
+		const DecodedResource *decoded = nullptr;
+		if ((uint32_t)i < decoded_resources.size() && decoded_resources[i].error == OK) {
+			decoded = &decoded_resources[i];
+		}
 
-		String t = get_unicode_string();
+		String t;
+		if (decoded) {
+			t = decoded->type;
+		} else {
+			f->seek(internal_resources[i].offset);
+			t = get_unicode_string();
+		}
 
 		Ref<Resource> res;
 		Resource *r = nullptr;
@@ -809,25 +1044,41 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
+		int pc = decoded ? (int)decoded->properties.size() : f->get_32();
 
 		//set properties
 
 		Dictionary missing_resource_properties;
 
 		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+			StringName name;
+			Variant value;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+			if (decoded) {
+				const DecodedProperty &property = decoded->properties[j];
+				name = property.name;
+				if (property.deferred_offset) {
+					// Now that what it references is loaded.
+					f->seek(property.deferred_offset);
+					error = parse_variant(value);
+					if (error) {
+						return error;
+					}
+				} else {
+					value = property.value;
+				}
+			} else {
+				name = _get_string();
 
-			Variant value;
+				if (name == StringName()) {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V(ERR_FILE_CORRUPT);
+				}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
+				error = parse_variant(value);
+				if (error) {
+					return error;
+				}
 			}
 
 			bool set_valid = true;
@@ -893,6 +1144,7 @@ Error ResourceLoaderBinary::load() {
 
 		if (main) {
 			f.unref();
+			decoded_resources.clear();
 			resource = res;
 			resource->set_as_translation_remapped(translation_remapped);
 			error = OK;
@@ -925,14 +1177,20 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
+	// Long strings (e.g. embedded source code) are parsed in place when the file can lend its memory.
+	const uint8_t *view = len >= 4096 ? f->get_buffer_view(len) : nullptr;
+	if (view) {
+		s.parse_utf8((const char *)view, len);
+		return s;
+	}
+	if (len > str_buf.size()) {
+		str_buf.resize(len);
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], len);
 	s.parse_utf8(&str_buf[0], len);
 	return s;
 }
@@ -1122,6 +1380,16 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 	}
 }
 
+ResourceLoaderBinary::~ResourceLoaderBinary() {
+	if (dependency_prefetch_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(dependency_prefetch_task);
+	}
+	if (prefetch_pending) {
+		// The read still targets prefetch_buffer.
+		prefetch_semaphore.wait();
+	}
+}
+
 String ResourceLoaderBinary::recognize(Ref<FileAccess> p_f) {
 	error = OK;
 
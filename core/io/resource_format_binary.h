@@ -33,6 +33,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/semaphore.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -92,6 +96,56 @@ class ResourceLoaderBinary {
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
+	// The file read in the background while dependencies load, parsed from memory once there.
+	Vector<uint8_t> prefetch_buffer;
+	Semaphore prefetch_semaphore;
+	int64_t prefetch_read = -1;
+	bool prefetch_pending = false;
+
+	// Opens dependencies and has the OS read them ahead, off the loading thread.
+	WorkerThreadPool::TaskID dependency_prefetch_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _prefetch_callback(void *p_userdata, int64_t p_read);
+	static void _prefetch_dependency_callback(void *p_userdata, int64_t p_read);
+	static void _prefetch_dependencies_task(void *p_userdata);
+	void _start_prefetch();
+	void _finish_prefetch();
+	Ref<FileAccess> _open_prefetch_buffer() const;
+
+	struct DecodedProperty {
+		StringName name;
+		Variant value;
+		// Values referencing resources are parsed again from here once those exist.
+		uint64_t deferred_offset = 0;
+	};
+
+	struct DecodedResource {
+		String type;
+		LocalVector<DecodedProperty> properties;
+		Error error = ERR_UNAVAILABLE;
+	};
+
+	// Internal resources decoded on worker threads ahead of load(), which only links them.
+	LocalVector<DecodedResource> decoded_resources;
+	// Set while decoding, references are skipped and only flagged then.
+	bool decoding = false;
+	bool deferred_reference = false;
+
+	// Next resource to decode, shared by the loading thread and the worker tasks.
+	SafeNumeric<uint32_t> decode_next;
+
+#ifdef TESTS_ENABLED
+	friend class TestResourceLoaderBinaryAccessor;
+
+	static SafeNumeric<uint64_t> parallel_decode_count;
+	static bool parallel_decode_disabled;
+#endif
+
+	void _decode_resources();
+	void _decode_resource(uint32_t p_index);
+	void _decode_pending_resources();
+	static void _decode_resources_task(void *p_userdata);
+
 public:
 	Ref<Resource> get_resource();
 	Error load();
@@ -105,6 +159,7 @@ public:
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
 
 	ResourceLoaderBinary() {}
+	~ResourceLoaderBinary();
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
@@ -151,6 +151,10 @@ public:
 	virtual bool can_import_threaded() const { return false; }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
+	// Whether the output of import() only depends on the source file and options, and
+	// consists only of the files referenced by the .import file, so it can be shared
+	// through EditorImportCache.
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const { return false; }
 
 	virtual Error import_group_file(const String &p_group_file, const HashMap<String, HashMap<StringName, Variant>> &p_source_file_options, const HashMap<String, String> &p_base_paths) { return ERR_UNAVAILABLE; }
 	virtual bool are_import_settings_valid(const String &p_path, const Dictionary &p_meta) const { return true; }
@@ -49,44 +49,51 @@ Error UDPServer::poll() {
 		return ERR_UNCONFIGURED;
 	}
 	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	int received;
 	while (true) {
-		err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+		for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+			recv_datagrams[i].size = PACKET_BUFFER_SIZE;
+		}
+		err = _sock->recvfrom_batch(recv_datagrams, RECV_BATCH_SIZE, received);
 		if (err != OK) {
 			if (err == ERR_BUSY) {
 				break;
 			}
 			return FAILED;
 		}
-		Peer p;
-		p.ip = ip;
-		p.port = port;
-		List<Peer>::Element *E = peers.find(p);
-		if (!E) {
-			E = pending.find(p);
-		}
-		if (E) {
-			E->get().peer->store_packet(ip, port, recv_buffer, read);
-		} else {
-			if (pending.size() >= max_pending_connections) {
-				// Drop connection.
-				continue;
-			}
-			// It's a new peer, add it to the pending list.
-			Peer peer;
-			peer.ip = ip;
-			peer.port = port;
-			peer.peer = memnew(PacketPeerUDP);
-			peer.peer->connect_shared_socket(_sock, ip, port, this);
-			peer.peer->store_packet(ip, port, recv_buffer, read);
-			pending.push_back(peer);
+		for (int i = 0; i < received; i++) {
+			_store_packet(recv_datagrams[i]);
 		}
 	}
 	return OK;
 }
 
+void UDPServer::_store_packet(const NetSocket::Datagram &p_datagram) {
+	Peer p;
+	p.ip = p_datagram.ip;
+	p.port = p_datagram.port;
+	List<Peer>::Element *E = peers.find(p);
+	if (!E) {
+		E = pending.find(p);
+	}
+	if (E) {
+		E->get().peer->store_packet(p_datagram.ip, p_datagram.port, p_datagram.buffer, p_datagram.size);
+		return;
+	}
+	if (pending.size() >= max_pending_connections) {
+		// Drop connection.
+		return;
+	}
+	// It's a new peer, add it to the pending list.
+	Peer peer;
+	peer.ip = p_datagram.ip;
+	peer.port = p_datagram.port;
+	peer.peer = memnew(PacketPeerUDP);
+	peer.peer->connect_shared_socket(_sock, p_datagram.ip, p_datagram.port, this);
+	peer.peer->store_packet(p_datagram.ip, p_datagram.port, p_datagram.buffer, p_datagram.size);
+	pending.push_back(peer);
+}
+
 Error UDPServer::listen(uint16_t p_port, const IPAddress &p_bind_address) {
 	ERR_FAIL_COND_V(_sock.is_null(), ERR_UNAVAILABLE);
 	ERR_FAIL_COND_V(_sock->is_open(), ERR_ALREADY_IN_USE);
@@ -113,6 +120,11 @@ Error UDPServer::listen(uint16_t p_port, const IPAddress &p_bind_address) {
 		stop();
 		return err;
 	}
+
+	recv_buffer.resize(RECV_BATCH_SIZE * PACKET_BUFFER_SIZE);
+	for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+		recv_datagrams[i].buffer = &recv_buffer[i * PACKET_BUFFER_SIZE];
+	}
 	return OK;
 }
 
@@ -194,6 +206,7 @@ void UDPServer::stop() {
 	}
 	peers.clear();
 	pending.clear();
+	recv_buffer.reset();
 }
 
 UDPServer::UDPServer() :
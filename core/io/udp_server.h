@@ -32,13 +32,15 @@
 
 #include "core/io/net_socket.h"
 #include "core/io/packet_peer_udp.h"
+#include "core/templates/local_vector.h"
 
 class UDPServer : public RefCounted {
 	GDCLASS(UDPServer, RefCounted);
 
 protected:
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		RECV_BATCH_SIZE = 8,
 	};
 
 	struct Peer {
@@ -50,13 +52,15 @@ protected:
 			return (ip == p_other.ip && port == p_other.port);
 		}
 	};
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
+	LocalVector<uint8_t> recv_buffer; // RECV_BATCH_SIZE packets, allocated when listening.
+	NetSocket::Datagram recv_datagrams[RECV_BATCH_SIZE];
 
 	List<Peer> peers;
 	List<Peer> pending;
 	int max_pending_connections = 16;
 
 	Ref<NetSocket> _sock;
+	void _store_packet(const NetSocket::Datagram &p_datagram);
 	static void _bind_methods();
 
 public:
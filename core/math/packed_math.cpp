@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  packed_math.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "packed_math.h"
+
+#include "core/object/worker_thread_pool.h"
+
+struct PackedMathChunks {
+	void (*func)(void *, int64_t, int64_t) = nullptr;
+	void *userdata = nullptr;
+	int64_t count = 0;
+	int64_t chunk_size = 0;
+
+	static void run(void *p_userdata, uint32_t p_chunk) {
+		const PackedMathChunks *chunks = (const PackedMathChunks *)p_userdata;
+		const int64_t from = p_chunk * chunks->chunk_size;
+		chunks->func(chunks->userdata, from, MIN(from + chunks->chunk_size, chunks->count));
+	}
+};
+
+void PackedMath::_for_each_chunk(RangeFunc p_func, void *p_userdata, int64_t p_count) {
+	PackedMathChunks chunks;
+	chunks.func = p_func;
+	chunks.userdata = p_userdata;
+	chunks.count = p_count;
+	chunks.chunk_size = CHUNK_SIZE;
+	const int64_t chunk_count = (p_count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Waiting on a group from inside the pool could starve it, so pool threads stay serial.
+	if (p_count >= PARALLEL_THRESHOLD && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group = pool->add_native_group_task(&PackedMathChunks::run, &chunks, chunk_count, -1, true, "PackedMath");
+		pool->wait_for_group_task_completion(group);
+		return;
+	}
+
+	for (int64_t i = 0; i < chunk_count; i++) {
+		PackedMathChunks::run(&chunks, i);
+	}
+}
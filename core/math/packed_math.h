@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  packed_math.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/math/color.h"
+#include "core/math/transform_3d.h"
+#include "core/math/vector3.h"
+#include "core/templates/local_vector.h"
+
+// Element-wise math over contiguous buffers, backing the bulk methods of the
+// Packed*Array types. The inner loops are kept branch-free so the compiler
+// can vectorize them, and large inputs are split across the WorkerThreadPool.
+// Work is always divided into the same fixed-size chunks, so reductions give
+// identical results whether or not they ran in parallel.
+class PackedMath {
+	static constexpr int64_t CHUNK_SIZE = 16384;
+	static constexpr int64_t PARALLEL_THRESHOLD = CHUNK_SIZE * 4;
+
+	typedef void (*RangeFunc)(void *p_userdata, int64_t p_from, int64_t p_to);
+
+	// Calls p_func for every chunk of [0, p_count), in parallel for large counts.
+	static void _for_each_chunk(RangeFunc p_func, void *p_userdata, int64_t p_count);
+
+	template <typename F>
+	static void _for_each_range(int64_t p_count, const F &p_func) {
+		_for_each_chunk([](void *p_ud, int64_t p_from, int64_t p_to) { (*(const F *)p_ud)(p_from, p_to); }, (void *)&p_func, p_count);
+	}
+
+	static _FORCE_INLINE_ float _min(float p_a, float p_b) { return MIN(p_a, p_b); }
+	static _FORCE_INLINE_ double _min(double p_a, double p_b) { return MIN(p_a, p_b); }
+	static _FORCE_INLINE_ Vector3 _min(const Vector3 &p_a, const Vector3 &p_b) { return p_a.min(p_b); }
+	static _FORCE_INLINE_ float _max(float p_a, float p_b) { return MAX(p_a, p_b); }
+	static _FORCE_INLINE_ double _max(double p_a, double p_b) { return MAX(p_a, p_b); }
+	static _FORCE_INLINE_ Vector3 _max(const Vector3 &p_a, const Vector3 &p_b) { return p_a.max(p_b); }
+	static _FORCE_INLINE_ float _clamp(float p_v, float p_min, float p_max) { return CLAMP(p_v, p_min, p_max); }
+	static _FORCE_INLINE_ double _clamp(double p_v, double p_min, double p_max) { return CLAMP(p_v, p_min, p_max); }
+	static _FORCE_INLINE_ Vector3 _clamp(const Vector3 &p_v, const Vector3 &p_min, const Vector3 &p_max) { return p_v.clamp(p_min, p_max); }
+	static _FORCE_INLINE_ Color _clamp(const Color &p_v, const Color &p_min, const Color &p_max) { return p_v.clamp(p_min, p_max); }
+
+	template <typename T, typename Op>
+	static T _reduce(const T *p_data, int64_t p_count, Op p_op) {
+		if (p_count == 0) {
+			return T();
+		}
+		LocalVector<T> partials;
+		partials.resize((p_count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+		T *w = partials.ptr();
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			T r = p_data[p_from];
+			for (int64_t i = p_from + 1; i < p_to; i++) {
+				r = p_op(r, p_data[i]);
+			}
+			w[p_from / CHUNK_SIZE] = r;
+		});
+		T r = w[0];
+		for (uint32_t i = 1; i < partials.size(); i++) {
+			r = p_op(r, w[i]);
+		}
+		return r;
+	}
+
+public:
+	// p_data[i] = p_data[i] * p_multiplier + p_addend
+	template <typename T, typename S>
+	static void multiply_add(T *p_data, int64_t p_count, const S &p_multiplier, const S &p_addend) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			for (int64_t i = p_from; i < p_to; i++) {
+				p_data[i] = p_data[i] * p_multiplier + p_addend;
+			}
+		});
+	}
+
+	template <typename T>
+	static void add(T *p_data, const T *p_values, int64_t p_count) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			for (int64_t i = p_from; i < p_to; i++) {
+				p_data[i] = p_data[i] + p_values[i];
+			}
+		});
+	}
+
+	template <typename T>
+	static void multiply(T *p_data, const T *p_values, int64_t p_count) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			for (int64_t i = p_from; i < p_to; i++) {
+				p_data[i] = p_data[i] * p_values[i];
+			}
+		});
+	}
+
+	template <typename T, typename W>
+	static void lerp(T *p_data, const T *p_to, int64_t p_count, W p_weight) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_end) {
+			for (int64_t i = p_from; i < p_end; i++) {
+				p_data[i] = p_data[i] + (p_to[i] - p_data[i]) * p_weight;
+			}
+		});
+	}
+
+	template <typename T>
+	static void clamp(T *p_data, int64_t p_count, const T &p_min, const T &p_max) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			for (int64_t i = p_from; i < p_to; i++) {
+				p_data[i] = _clamp(p_data[i], p_min, p_max);
+			}
+		});
+	}
+
+	static void transform(Vector3 *p_data, int64_t p_count, const Transform3D &p_transform) {
+		_for_each_range(p_count, [&](int64_t p_from, int64_t p_to) {
+			for (int64_t i = p_from; i < p_to; i++) {
+				p_data[i] = p_transform.xform(p_data[i]);
+			}
+		});
+	}
+
+	// Reductions return a default-constructed value for empty input.
+	template <typename T>
+	static T sum(const T *p_data, int64_t p_count) {
+		return _reduce(p_data, p_count, [](const T &p_a, const T &p_b) { return p_a + p_b; });
+	}
+
+	template <typename T>
+	static T min(const T *p_data, int64_t p_count) {
+		return _reduce(p_data, p_count, [](const T &p_a, const T &p_b) { return _min(p_a, p_b); });
+	}
+
+	template <typename T>
+	static T max(const T *p_data, int64_t p_count) {
+		return _reduce(p_data, p_count, [](const T &p_a, const T &p_b) { return _max(p_a, p_b); });
+	}
+};
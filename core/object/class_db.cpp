@@ -1035,7 +1035,88 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 	return false;
 }
 
+// Lock-free unless the tables are missing or stale. The returned tables stay alive until cleanup().
+ClassDB::FlatTables *ClassDB::_get_flat_tables(ClassInfo *p_class) {
+	FlatTables *current = p_class->flat.tables.load(std::memory_order_acquire);
+	if (likely(current && current->version == flat_tables_version.get())) {
+		return current;
+	}
+
+	// Building reads the class maps, which only change under the write lock.
+	OBJTYPE_RLOCK;
+	const uint64_t version = flat_tables_version.get();
+	current = p_class->flat.tables.load(std::memory_order_acquire);
+	if (current && current->version == version) {
+		return current; // Built by another thread meanwhile.
+	}
+
+	FlatTables *tables = memnew(FlatTables);
+	tables->version = version;
+	// Names a derived class resolves to a constant, method or signal before reaching an inherited property.
+	HashSet<StringName> shadowing;
+	for (ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			if (E.value && !tables->methods.has(E.key)) {
+				tables->methods.insert(E.key, E.value);
+			}
+		}
+		for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+			if (!tables->properties.has(E.key)) {
+				tables->properties.insert(E.key, { &E.value, shadowing.has(E.key) });
+			}
+		}
+		for (const KeyValue<StringName, int64_t> &E : check->constant_map) {
+			shadowing.insert(E.key);
+		}
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			shadowing.insert(E.key);
+		}
+		for (const KeyValue<StringName, MethodInfo> &E : check->signal_map) {
+			shadowing.insert(E.key);
+		}
+	}
+
+	if (!p_class->flat.tables.compare_exchange_strong(current, tables, std::memory_order_acq_rel)) {
+		// Another thread built them first.
+		memdelete(tables);
+		return current;
+	}
+	if (current) {
+		MutexLock retired_lock(retired_flat_tables_mutex);
+		retired_flat_tables.push_back(current);
+	}
+	return tables;
+}
+
+// Must be called with the write lock held. Marking every table stale keeps binds
+// O(1); tables are only rebuilt for classes that are looked up again.
+void ClassDB::_invalidate_flat_tables() {
+	if (!frozen.is_set()) {
+		return; // Tables are only built once frozen.
+	}
+	flat_tables_version.increment();
+}
+
+void ClassDB::freeze() {
+	frozen.set();
+}
+
+void ClassDB::unfreeze() {
+	OBJTYPE_WLOCK;
+	_invalidate_flat_tables();
+	frozen.clear();
+}
+
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	if (frozen.is_set()) {
+		ClassInfo *type = classes.getptr(p_class);
+		if (unlikely(!type)) {
+			return nullptr;
+		}
+		MethodBind *const *method = _get_flat_tables(type)->methods.getptr(p_name);
+		return method ? *method : nullptr;
+	}
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -1115,6 +1196,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 		ERR_FAIL();
 	}
 
+	_invalidate_flat_tables();
 	type->constant_map[p_name] = p_constant;
 
 	String enum_name = p_enum;
@@ -1354,6 +1436,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 	}
 #endif
 
+	_invalidate_flat_tables();
 	type->signal_map[sname] = p_signal;
 }
 
@@ -1506,6 +1589,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.index = p_index;
 	psg.type = p_pinfo.type;
 
+	_invalidate_flat_tables();
 	type->property_setget[p_pinfo.name] = psg;
 }
 
@@ -1603,81 +1687,72 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
+	const PropertySetGet *psg = nullptr;
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+	if (type && frozen.is_set()) {
+		const FlatTables::Property *property = _get_flat_tables(type)->properties.getptr(p_property);
+		psg = property ? property->setget : nullptr;
+	} else {
+		for (ClassInfo *check = type; check && !psg; check = check->inherits_ptr) {
+			psg = check->property_setget.getptr(p_property);
+		}
+	}
 
-			Callable::CallError ce;
+	return psg && _set_property(p_object, psg, p_value, r_valid);
+}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+bool ClassDB::_set_property(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return true; //return true but do nothing
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	Callable::CallError ce;
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(p_setget->setter,arg,2,ce);
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 2, ce);
+		}
 
-			return true;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 1, ce);
 		}
+	}
 
-		check = check->inherits_ptr;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
 	}
 
-	return false;
+	return true;
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	if (type && frozen.is_set()) {
+		const FlatTables::Property *property = _get_flat_tables(type)->properties.getptr(p_property);
+		if (property && !property->shadowed) {
+			return _get_property(p_object, property->setget, r_value);
+		}
+	}
+
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				const Variant value = p_object->callp(psg->getter, arg, 1, ce);
-				r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					const Variant value = p_object->callp(psg->getter, nullptr, 0, ce);
-					r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
-				}
-			}
-			return true;
+			return _get_property(p_object, psg, r_value);
 		}
 
 		const int64_t *c = check->constant_map.getptr(p_property); //constants count
@@ -1708,6 +1783,30 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 	return false;
 }
 
+bool ClassDB::_get_property(Object *p_object, const PropertySetGet *p_setget, Variant &r_value) {
+	if (!p_setget->getter) {
+		return true; //return true but do nothing
+	}
+
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[1] = { &index };
+		Callable::CallError ce;
+		const Variant value = p_object->callp(p_setget->getter, arg, 1, ce);
+		r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+
+	} else {
+		Callable::CallError ce;
+		if (p_setget->_getptr) {
+			r_value = p_setget->_getptr->call(p_object, nullptr, 0, ce);
+		} else {
+			const Variant value = p_object->callp(p_setget->getter, nullptr, 0, ce);
+			r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+		}
+	}
+	return true;
+}
+
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1810,7 +1909,14 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
+	if (!p_no_inheritance && type && frozen.is_set()) {
+		return _get_flat_tables(type)->methods.has(p_method);
+	}
+	return _has_method(type, p_method, p_no_inheritance);
+}
+
+bool ClassDB::_has_method(const ClassInfo *p_class, const StringName &p_method, bool p_no_inheritance) {
+	const ClassInfo *check = p_class;
 	while (check) {
 		if (check->method_map.has(p_method)) {
 			return true;
@@ -1889,6 +1995,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 	type->method_order.push_back(method_name);
 #endif
 
+	_invalidate_flat_tables();
 	type->method_map[method_name] = p_method;
 }
 
@@ -1899,6 +2006,8 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 
 	String instance_type = bind->get_instance_class();
 
+	OBJTYPE_WLOCK;
+
 	ClassInfo *type = classes.getptr(instance_type);
 	if (!type) {
 		memdelete(bind);
@@ -1915,6 +2024,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		// Overloading not supported
 		ERR_FAIL_V_MSG(nullptr, vformat("Method already bound: '%s::%s'.", instance_type, p_name));
 	}
+	_invalidate_flat_tables();
 	type->method_map[p_name] = bind;
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
@@ -1941,7 +2051,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 
 #ifdef DEBUG_ENABLED
 
-	ERR_FAIL_COND_V_MSG(!p_compatibility && has_method(instance_type, mdname), nullptr, vformat("Class '%s' already has a method '%s'.", String(instance_type), String(mdname)));
+	ERR_FAIL_COND_V_MSG(!p_compatibility && _has_method(classes.getptr(instance_type), mdname, false), nullptr, vformat("Class '%s' already has a method '%s'.", String(instance_type), String(mdname)));
 #endif
 
 	ClassInfo *type = classes.getptr(instance_type);
@@ -1978,6 +2088,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 	if (p_compatibility) {
 		_bind_compatibility(type, p_bind);
 	} else {
+		_invalidate_flat_tables();
 		type->method_map[mdname] = p_bind;
 	}
 
@@ -2303,8 +2414,11 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
+	OBJTYPE_WLOCK;
+
 	ClassInfo *c = classes.getptr(p_class);
 	ERR_FAIL_NULL_MSG(c, vformat("Class '%s' does not exist.", String(p_class)));
+	_invalidate_flat_tables();
 	if (p_free_method_binds) {
 		for (KeyValue<StringName, MethodBind *> &F : c->method_map) {
 			memdelete(F.value);
@@ -2343,6 +2457,10 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 }
 
 RWLock ClassDB::lock;
+SafeFlag ClassDB::frozen;
+SafeNumeric<uint64_t> ClassDB::flat_tables_version;
+LocalVector<ClassDB::FlatTables *> ClassDB::retired_flat_tables;
+Mutex ClassDB::retired_flat_tables_mutex;
 
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
@@ -2352,6 +2470,8 @@ void ClassDB::cleanup_defaults() {
 void ClassDB::cleanup() {
 	//OBJTYPE_LOCK; hah not here
 
+	frozen.clear();
+
 	for (KeyValue<StringName, ClassInfo> &E : classes) {
 		ClassInfo &ti = E.value;
 
@@ -2369,6 +2489,11 @@ void ClassDB::cleanup() {
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
+
+	for (FlatTables *tables : retired_flat_tables) {
+		memdelete(tables);
+	}
+	retired_flat_tables.clear();
 }
 
 // Array to use in optional parameters on methods and the DEFVAL_ARRAY macro.
@@ -37,6 +37,7 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/hash_set.h"
 
 #include <type_traits>
@@ -97,6 +98,39 @@ public:
 		Variant::Type type;
 	};
 
+	// Method and property lookup tables of a class merged with those of all its
+	// ancestors, so frozen lookups need a single hash lookup. See freeze().
+	struct FlatTables {
+		struct Property {
+			const PropertySetGet *setget = nullptr;
+			// A constant, method or signal of a derived class has the same name, which get_property() prefers.
+			bool shadowed = false;
+		};
+		AHashMap<StringName, MethodBind *> methods;
+		AHashMap<StringName, Property> properties;
+		// Value of flat_tables_version when built. Older tables are stale.
+		uint64_t version = 0;
+	};
+
+	// Built lazily once ClassDB is frozen. Copies of a ClassInfo start without tables.
+	// Read without the lock, replaced under the read lock, and never freed before cleanup().
+	struct FlatTablesRef {
+		std::atomic<FlatTables *> tables = nullptr;
+
+		FlatTablesRef() {}
+		FlatTablesRef(const FlatTablesRef &p_from) {}
+		void operator=(const FlatTablesRef &p_from) { _free(); }
+		~FlatTablesRef() { _free(); }
+
+	private:
+		void _free() {
+			FlatTables *old = tables.exchange(nullptr);
+			if (old) {
+				memdelete(old);
+			}
+		}
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -138,6 +172,8 @@ public:
 		// The bool argument indicates the need to postinitialize.
 		Object *(*creation_func)(bool) = nullptr;
 
+		FlatTablesRef flat;
+
 		ClassInfo() {}
 		~ClassInfo() {}
 	};
@@ -154,6 +190,20 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+
+	static SafeFlag frozen;
+	static SafeNumeric<uint64_t> flat_tables_version;
+	// Stale tables replaced by a lookup, which other lookups may still be reading.
+	// Lookups don't take the lock, so they are only freed by cleanup().
+	static LocalVector<FlatTables *> retired_flat_tables;
+	static Mutex retired_flat_tables_mutex;
+
+	static FlatTables *_get_flat_tables(ClassInfo *p_class);
+	static void _invalidate_flat_tables();
+	static bool _has_method(const ClassInfo *p_class, const StringName &p_method, bool p_no_inheritance);
+
+	static bool _set_property(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid);
+	static bool _get_property(Object *p_object, const PropertySetGet *p_setget, Variant &r_value);
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -493,6 +543,15 @@ public:
 	static void cleanup_defaults();
 	static void cleanup();
 
+	// Marks registration as finished: method and property lookups then use per-class
+	// flattened tables, built on first use, instead of walking the class hierarchy.
+	// Any change made afterwards (e.g. by an extension) marks all tables stale, and
+	// each is rebuilt on its next lookup.
+	static void freeze();
+	// Goes back to walking the class hierarchy. Used by tests.
+	static void unfreeze();
+	static bool is_frozen() { return frozen.is_set(); }
+
 	static void register_native_struct(const StringName &p_name, const String &p_code, uint64_t p_current_size);
 	static void get_native_struct_list(List<StringName> *r_names);
 	static String get_native_struct_code(const StringName &p_name);
@@ -222,6 +222,10 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_alloc_count() {
+	return alloc_count.get();
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
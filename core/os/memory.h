@@ -88,6 +88,8 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	// Number of blocks currently allocated through alloc_static.
+	static uint64_t get_alloc_count();
 };
 
 class DefaultAllocator {
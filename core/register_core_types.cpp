@@ -54,6 +54,7 @@
 #include "core/io/packet_peer.h"
 #include "core/io/packet_peer_dtls.h"
 #include "core/io/packet_peer_udp.h"
+#include "core/io/packet_peer_zstd.h"
 #include "core/io/pck_packer.h"
 #include "core/io/resource_format_binary.h"
 #include "core/io/resource_importer.h"
@@ -200,6 +201,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(PacketPeerExtension);
 	GDREGISTER_CLASS(PacketPeerStream);
 	GDREGISTER_CLASS(PacketPeerUDP);
+	GDREGISTER_CLASS(PacketPeerZSTD);
 	GDREGISTER_CLASS(UDPServer);
 
 	GDREGISTER_ABSTRACT_CLASS(WorkerThreadPool);
@@ -258,6 +260,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(AStar2D);
 	GDREGISTER_CLASS(AStarGrid2D);
 	GDREGISTER_CLASS(EncodedObjectAsID);
+	GDREGISTER_CLASS(MarshallSchema);
 	GDREGISTER_CLASS(RandomNumberGenerator);
 
 	GDREGISTER_ABSTRACT_CLASS(ImageFormatLoader);
@@ -0,0 +1,704 @@
+/**************************************************************************/
+/*  compact_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/a_hash_map.h"
+
+/**
+ * An insertion-ordered, open-addressing hash map with a compact memory layout.
+ *
+ * The order of the elements is kept in a dense array of entries holding their cached hash
+ * and a pointer to the element. A separate index table of `HashMapData` (shared with AHashMap)
+ * maps hashes to entry positions using Robin Hood linear probing.
+ *
+ * The elements themselves live in slots allocated in chunks of growing size, and never move:
+ * like with HashMap, pointers and references to keys and values stay valid until the element
+ * is erased. Erased slots are reused by the next insertions.
+ *
+ * Up to `INLINE_CAPACITY` entries and elements are stored inside the map itself. While in
+ * inline mode there is no index table and lookups scan the cached hashes, so tiny maps never
+ * allocate. As a consequence, the map itself must not be relocated in memory.
+ *
+ * Erasing an element preserves the order of the remaining ones: its entry becomes a hole
+ * which iteration skips, and holes are reclaimed by compacting the entries when they run
+ * out of space.
+ *
+ *  insert A B C D, erase B:   A X C D
+ *  insert E (entries full):   A C D E
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		uint32_t INLINE_CAPACITY = 4>
+class CompactHashMap {
+public:
+	static constexpr uint32_t EMPTY_HASH = 0;
+	// Must be a power of two.
+	static constexpr uint32_t MIN_HEAP_CAPACITY = 8;
+	// Slot chunks double in size up to this many elements.
+	static constexpr uint32_t MAX_CHUNK_CAPACITY = 1024;
+	static_assert(INLINE_CAPACITY > 0 && INLINE_CAPACITY < MIN_HEAP_CAPACITY, "INLINE_CAPACITY must be smaller than MIN_HEAP_CAPACITY.");
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Entry {
+		uint32_t hash; // EMPTY_HASH marks a hole left by an erased element.
+		MapKeyValue *data;
+	};
+
+	// Storage for one element. Free slots point to the next free one.
+	union Slot {
+		Slot *next_free;
+		alignas(MapKeyValue) uint8_t data[sizeof(MapKeyValue)];
+	};
+
+	struct alignas(Slot) SlotChunk {
+		SlotChunk *next;
+		uint32_t capacity;
+		uint32_t used;
+
+		_FORCE_INLINE_ Slot *get_slots() {
+			return reinterpret_cast<Slot *>(this + 1);
+		}
+	};
+
+	Entry inline_entries[INLINE_CAPACITY];
+	Slot inline_slots[INLINE_CAPACITY];
+	Entry *heap_entries = nullptr;
+	HashMapData *index = nullptr; // nullptr while entries are stored inline.
+	SlotChunk *chunks = nullptr; // Most recent first.
+	Slot *free_slots = nullptr;
+
+	// Due to optimization, this is `index capacity - 1`. Always twice the entry capacity.
+	uint32_t index_capacity = 0;
+	uint32_t entry_capacity = INLINE_CAPACITY;
+	uint32_t used = 0; // Entries in use, including holes.
+	uint32_t num_elements = 0;
+	uint32_t inline_slots_used = 0;
+
+	_FORCE_INLINE_ Entry *_get_entries() const {
+		return index ? heap_entries : const_cast<Entry *>(inline_entries);
+	}
+
+	uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash, uint32_t p_local_capacity) {
+		const uint32_t original_pos = p_hash & p_local_capacity;
+		return (p_pos - original_pos + p_local_capacity + 1) & p_local_capacity;
+	}
+
+	bool _lookup_pos_with_hash(const TKey &p_key, uint32_t &r_pos, uint32_t &r_index_pos, uint32_t p_hash) const {
+		const Entry *entries = _get_entries();
+
+		if (index == nullptr) {
+			for (uint32_t i = 0; i < used; i++) {
+				if (entries[i].hash == p_hash && Comparator::compare(entries[i].data->key, p_key)) {
+					r_pos = i;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		uint32_t pos = p_hash & index_capacity;
+		uint32_t distance = 0;
+		while (true) {
+			const HashMapData data = index[pos];
+			if (data.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (data.hash == p_hash && Comparator::compare(entries[data.hash_to_key].data->key, p_key)) {
+				r_pos = data.hash_to_key;
+				r_index_pos = pos;
+				return true;
+			}
+
+			if (distance > _get_probe_length(pos, data.hash, index_capacity)) {
+				return false;
+			}
+
+			pos = (pos + 1) & index_capacity;
+			distance++;
+		}
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos, uint32_t &r_index_pos) const {
+		if (num_elements == 0) {
+			return false;
+		}
+		return _lookup_pos_with_hash(p_key, r_pos, r_index_pos, _hash(p_key));
+	}
+
+	void _index_insert(uint32_t p_hash, uint32_t p_pos) {
+		uint32_t pos = p_hash & index_capacity;
+		uint32_t distance = 0;
+		HashMapData c_data;
+		c_data.hash = p_hash;
+		c_data.hash_to_key = p_pos;
+
+		while (true) {
+			if (index[pos].hash == EMPTY_HASH) {
+				index[pos] = c_data;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, index[pos].hash, index_capacity);
+			if (existing_probe_len < distance) {
+				SWAP(c_data, index[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & index_capacity;
+			distance++;
+		}
+	}
+
+	void _index_erase(uint32_t p_index_pos) {
+		uint32_t pos = p_index_pos;
+		uint32_t next_pos = (pos + 1) & index_capacity;
+		while (index[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, index[next_pos].hash, index_capacity) != 0) {
+			SWAP(index[next_pos], index[pos]);
+
+			pos = next_pos;
+			next_pos = (next_pos + 1) & index_capacity;
+		}
+
+		index[pos].data = EMPTY_HASH;
+	}
+
+	void _rebuild_index() {
+		memset(index, EMPTY_HASH, sizeof(HashMapData) * (index_capacity + 1));
+		const Entry *entries = _get_entries();
+		for (uint32_t i = 0; i < used; i++) {
+			_index_insert(entries[i].hash, i);
+		}
+	}
+
+	// Moves the live entries of `p_src` to the front of `p_dst`, dropping holes. Both may be the same array.
+	uint32_t _move_entries(Entry *p_dst, const Entry *p_src) {
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < used; i++) {
+			if (p_src[i].hash != EMPTY_HASH) {
+				p_dst[count++] = p_src[i];
+			}
+		}
+		return count;
+	}
+
+	// Called when the entry array is full. Reclaims holes if that frees enough space, otherwise grows.
+	void _make_room() {
+		if ((used - num_elements) * 2 >= entry_capacity) {
+			used = _move_entries(_get_entries(), _get_entries());
+			if (index) {
+				_rebuild_index();
+			}
+			return;
+		}
+		_resize(MAX(MIN_HEAP_CAPACITY, entry_capacity * 2));
+	}
+
+	void _resize(uint32_t p_new_capacity) {
+		Entry *new_entries = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * p_new_capacity));
+		used = _move_entries(new_entries, _get_entries());
+
+		if (index) {
+			Memory::free_static(heap_entries);
+			Memory::free_static(index);
+		}
+
+		heap_entries = new_entries;
+		entry_capacity = p_new_capacity;
+		index_capacity = p_new_capacity * 2 - 1;
+		index = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * (index_capacity + 1)));
+		_rebuild_index();
+	}
+
+	void _add_chunk(uint32_t p_capacity) {
+		SlotChunk *chunk = reinterpret_cast<SlotChunk *>(Memory::alloc_static(sizeof(SlotChunk) + sizeof(Slot) * p_capacity));
+		chunk->next = chunks;
+		chunk->capacity = p_capacity;
+		chunk->used = 0;
+		chunks = chunk;
+	}
+
+	MapKeyValue *_alloc_slot() {
+		Slot *slot;
+		if (free_slots) {
+			slot = free_slots;
+			free_slots = slot->next_free;
+		} else if (inline_slots_used < INLINE_CAPACITY) {
+			slot = &inline_slots[inline_slots_used++];
+		} else {
+			if (chunks == nullptr || chunks->used == chunks->capacity) {
+				_add_chunk(chunks ? MIN(chunks->capacity * 2, MAX(chunks->capacity, MAX_CHUNK_CAPACITY)) : MIN_HEAP_CAPACITY);
+			}
+			slot = chunks->get_slots() + chunks->used++;
+		}
+		return reinterpret_cast<MapKeyValue *>(slot->data);
+	}
+
+	void _free_slot(MapKeyValue *p_data) {
+		p_data->~MapKeyValue();
+		Slot *slot = reinterpret_cast<Slot *>(p_data);
+		slot->next_free = free_slots;
+		free_slots = slot;
+	}
+
+	// Makes sure the next insertions up to a total of `p_elements` don't need several chunks.
+	void _reserve_slots(uint32_t p_elements) {
+		if (chunks == nullptr && p_elements > INLINE_CAPACITY) {
+			_add_chunk(MAX(MIN_HEAP_CAPACITY, p_elements - INLINE_CAPACITY));
+		}
+	}
+
+	uint32_t _insert_entry(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(used == entry_capacity)) {
+			_make_room();
+		}
+
+		Entry *entry = _get_entries() + used;
+		entry->hash = p_hash;
+		entry->data = _alloc_slot();
+		memnew_placement(entry->data, MapKeyValue(p_key, p_value));
+
+		if (index) {
+			_index_insert(p_hash, used);
+		}
+
+		num_elements++;
+		return used++;
+	}
+
+	// Destroys all elements and releases their heap slots, keeping the entry array and index.
+	void _destroy_elements() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			Entry *entries = _get_entries();
+			for (uint32_t i = 0; i < used; i++) {
+				if (entries[i].hash != EMPTY_HASH) {
+					entries[i].data->~MapKeyValue();
+				}
+			}
+		}
+
+		while (chunks) {
+			SlotChunk *next = chunks->next;
+			Memory::free_static(chunks);
+			chunks = next;
+		}
+		free_slots = nullptr;
+		inline_slots_used = 0;
+	}
+
+	void _init_from(const CompactHashMap &p_other) {
+		if (p_other.num_elements > INLINE_CAPACITY) {
+			uint32_t new_capacity = MAX(MIN_HEAP_CAPACITY, next_power_of_2(p_other.num_elements));
+			heap_entries = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * new_capacity));
+			entry_capacity = new_capacity;
+			index_capacity = new_capacity * 2 - 1;
+			index = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * (index_capacity + 1)));
+			_reserve_slots(p_other.num_elements);
+		}
+
+		Entry *entries = _get_entries();
+		const Entry *other_entries = p_other._get_entries();
+		for (uint32_t i = 0; i < p_other.used; i++) {
+			if (other_entries[i].hash == EMPTY_HASH) {
+				continue;
+			}
+			entries[used].hash = other_entries[i].hash;
+			entries[used].data = _alloc_slot();
+			memnew_placement(entries[used].data, MapKeyValue(*other_entries[i].data));
+			used++;
+		}
+		num_elements = used;
+
+		if (index) {
+			_rebuild_index();
+		}
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return entry_capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	// Returns true while the elements are stored inside the map, without heap allocations.
+	_FORCE_INLINE_ bool is_inline() const {
+		return index == nullptr && chunks == nullptr;
+	}
+
+	void clear() {
+		_destroy_elements();
+		used = 0;
+		num_elements = 0;
+		if (index) {
+			memset(index, EMPTY_HASH, sizeof(HashMapData) * (index_capacity + 1));
+		}
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, index_pos);
+		CRASH_COND_MSG(!exists, "CompactHashMap key not found.");
+		return _get_entries()[pos].data->value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, index_pos);
+		CRASH_COND_MSG(!exists, "CompactHashMap key not found.");
+		return _get_entries()[pos].data->value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		if (_lookup_pos(p_key, pos, index_pos)) {
+			return &_get_entries()[pos].data->value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		if (_lookup_pos(p_key, pos, index_pos)) {
+			return &_get_entries()[pos].data->value;
+		}
+		return nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		return _lookup_pos(p_key, pos, index_pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		if (!_lookup_pos(p_key, pos, index_pos)) {
+			return false;
+		}
+
+		if (index) {
+			_index_erase(index_pos);
+		}
+
+		Entry *entries = _get_entries();
+		_free_slot(entries[pos].data);
+		entries[pos].hash = EMPTY_HASH;
+		entries[pos].data = nullptr;
+		num_elements--;
+
+		// Trailing holes can be reused right away.
+		while (used > 0 && entries[used - 1].hash == EMPTY_HASH) {
+			used--;
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		if (p_new_capacity <= entry_capacity) {
+			return;
+		}
+		_resize(MAX(MIN_HEAP_CAPACITY, next_power_of_2(p_new_capacity)));
+		_reserve_slots(p_new_capacity);
+	}
+
+	// Stable insertion sort by key, fast for the common case where the input is already (nearly) sorted.
+	// Only the entries are reordered, the elements keep their address.
+	void sort() {
+		if (num_elements < 2) {
+			return;
+		}
+
+		Entry *entries = _get_entries();
+		used = _move_entries(entries, entries);
+
+		for (uint32_t i = 1; i < used; i++) {
+			const Entry entry = entries[i];
+			uint32_t j = i;
+			while (j > 0 && _hashmap_variant_less_than(entry.data->key, entries[j - 1].data->key)) {
+				entries[j] = entries[j - 1];
+				j--;
+			}
+			entries[j] = entry;
+		}
+
+		if (index) {
+			_rebuild_index();
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *entry->data;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return entry->data;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			entry++;
+			_skip_holes();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return entry != end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(Entry *p_entry, Entry *p_end) {
+			entry = p_entry;
+			end = p_end;
+			_skip_holes();
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			entry = p_it.entry;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			entry = p_it.entry;
+			end = p_it.end;
+		}
+
+	private:
+		_FORCE_INLINE_ void _skip_holes() {
+			while (entry != end && entry->hash == EMPTY_HASH) {
+				entry++;
+			}
+		}
+
+		Entry *entry = nullptr;
+		Entry *end = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *entry->data;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return entry->data;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			entry++;
+			_skip_holes();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return entry != end;
+		}
+
+		_FORCE_INLINE_ Iterator(Entry *p_entry, Entry *p_end) {
+			entry = p_entry;
+			end = p_end;
+			_skip_holes();
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			entry = p_it.entry;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			entry = p_it.entry;
+			end = p_it.end;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(entry, end);
+		}
+
+	private:
+		_FORCE_INLINE_ void _skip_holes() {
+			while (entry != end && entry->hash == EMPTY_HASH) {
+				entry++;
+			}
+		}
+
+		Entry *entry = nullptr;
+		Entry *end = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(_get_entries(), _get_entries() + used);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(_get_entries() + used, _get_entries() + used);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		if (!_lookup_pos(p_key, pos, index_pos)) {
+			return end();
+		}
+		return Iterator(_get_entries() + pos, _get_entries() + used);
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(_get_entries(), _get_entries() + used);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(_get_entries() + used, _get_entries() + used);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		if (!_lookup_pos(p_key, pos, index_pos)) {
+			return end();
+		}
+		return ConstIterator(_get_entries() + pos, _get_entries() + used);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, index_pos);
+		CRASH_COND(!exists);
+		return _get_entries()[pos].data->value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		uint32_t hash = _hash(p_key);
+		if (!_lookup_pos_with_hash(p_key, pos, index_pos, hash)) {
+			pos = _insert_entry(p_key, TValue(), hash);
+		}
+		return _get_entries()[pos].data->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t pos = 0;
+		uint32_t index_pos = 0;
+		uint32_t hash = _hash(p_key);
+		if (!_lookup_pos_with_hash(p_key, pos, index_pos, hash)) {
+			pos = _insert_entry(p_key, p_value, hash);
+		} else {
+			_get_entries()[pos].data->value = p_value;
+		}
+		return Iterator(_get_entries() + pos, _get_entries() + used);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		uint32_t pos = _insert_entry(p_key, p_value, _hash(p_key));
+		return Iterator(_get_entries() + pos, _get_entries() + used);
+	}
+
+	/* Constructors */
+
+	CompactHashMap(const CompactHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const CompactHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+		_init_from(p_other);
+	}
+
+	CompactHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	CompactHashMap() {}
+
+	CompactHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	// Destroys all elements and releases the heap storage, going back to inline mode.
+	void reset() {
+		_destroy_elements();
+		if (index) {
+			Memory::free_static(heap_entries);
+			Memory::free_static(index);
+			heap_entries = nullptr;
+			index = nullptr;
+		}
+		index_capacity = 0;
+		entry_capacity = INLINE_CAPACITY;
+		used = 0;
+		num_elements = 0;
+	}
+
+	~CompactHashMap() {
+		reset();
+	}
+};
@@ -0,0 +1,356 @@
+/**************************************************************************/
+/*  inline_vector.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+/**
+ * @class InlineVector
+ * Vector with small-buffer optimization. Up to INLINE_CAPACITY elements are
+ * stored inside the container itself, so small vectors never allocate.
+ * Growing past that spills the elements to a regular copy-on-write Vector,
+ * which keeps copies of large vectors cheap.
+ *
+ * The API mirrors Vector so they can be swapped easily. Note that unlike
+ * Vector, copying a small InlineVector copies its elements.
+ */
+
+#include "core/templates/vector.h"
+
+template <typename T, uint32_t INLINE_CAPACITY>
+class InlineVector;
+
+template <typename T, uint32_t INLINE_CAPACITY>
+class InlineVectorWriteProxy {
+public:
+	_FORCE_INLINE_ T &operator[](int64_t p_index) {
+		InlineVector<T, INLINE_CAPACITY> *vector = (InlineVector<T, INLINE_CAPACITY> *)(this);
+		CRASH_BAD_INDEX(p_index, vector->size());
+
+		return vector->ptrw()[p_index];
+	}
+};
+
+template <typename T, uint32_t INLINE_CAPACITY>
+class InlineVector {
+	friend class InlineVectorWriteProxy<T, INLINE_CAPACITY>;
+	static_assert(INLINE_CAPACITY > 0, "INLINE_CAPACITY must be greater than 0.");
+
+public:
+	InlineVectorWriteProxy<T, INLINE_CAPACITY> write;
+	typedef typename Vector<T>::Size Size;
+
+private:
+	// The C# glue reads this layout for Array (see InteropStructs.cs), keep the inline elements last.
+	Vector<T> heap; // Only used once spilled.
+	Size inline_size = 0;
+	bool spilled = false;
+	alignas(T) uint8_t inline_data[sizeof(T) * INLINE_CAPACITY];
+
+	_FORCE_INLINE_ T *_get_inline() { return reinterpret_cast<T *>(inline_data); }
+	_FORCE_INLINE_ const T *_get_inline() const { return reinterpret_cast<const T *>(inline_data); }
+
+	void _destroy_inline(Size p_from) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			T *data = _get_inline();
+			for (Size i = p_from; i < inline_size; i++) {
+				data[i].~T();
+			}
+		}
+		inline_size = MIN(inline_size, p_from);
+	}
+
+	// Moves the inline elements to the heap Vector.
+	Error _spill(Size p_size) {
+		Error err = heap.resize(p_size);
+		ERR_FAIL_COND_V(err, err);
+
+		T *dst = heap.ptrw();
+		T *src = _get_inline();
+		for (Size i = 0; i < inline_size; i++) {
+			dst[i] = std::move(src[i]);
+		}
+		_destroy_inline(0);
+		spilled = true;
+		return OK;
+	}
+
+	void _copy_from(const InlineVector &p_from) {
+		if (p_from.spilled) {
+			heap = p_from.heap;
+			spilled = true;
+			return;
+		}
+		const T *src = p_from._get_inline();
+		T *dst = _get_inline();
+		for (Size i = 0; i < p_from.inline_size; i++) {
+			memnew_placement(&dst[i], T(src[i]));
+		}
+		inline_size = p_from.inline_size;
+	}
+
+	// Expects this vector to be empty and inline.
+	void _move_from(InlineVector &&p_from) {
+		if (p_from.spilled) {
+			heap = std::move(p_from.heap);
+			spilled = true;
+			p_from.spilled = false;
+			return;
+		}
+		T *src = p_from._get_inline();
+		T *dst = _get_inline();
+		for (Size i = 0; i < p_from.inline_size; i++) {
+			memnew_placement(&dst[i], T(std::move(src[i])));
+		}
+		inline_size = p_from.inline_size;
+		p_from._destroy_inline(0);
+	}
+
+public:
+	_FORCE_INLINE_ bool is_spilled() const { return spilled; }
+
+	_FORCE_INLINE_ T *ptrw() { return spilled ? heap.ptrw() : _get_inline(); }
+	_FORCE_INLINE_ const T *ptr() const { return spilled ? heap.ptr() : _get_inline(); }
+	_FORCE_INLINE_ Size size() const { return spilled ? heap.size() : inline_size; }
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
+
+	_FORCE_INLINE_ const T &get(Size p_index) const {
+		CRASH_BAD_INDEX(p_index, size());
+		return ptr()[p_index];
+	}
+	_FORCE_INLINE_ const T &operator[](Size p_index) const {
+		CRASH_BAD_INDEX(p_index, size());
+		return ptr()[p_index];
+	}
+	_FORCE_INLINE_ void set(Size p_index, const T &p_elem) {
+		ERR_FAIL_INDEX(p_index, size());
+		ptrw()[p_index] = p_elem;
+	}
+
+	Error resize(Size p_size) {
+		ERR_FAIL_COND_V(p_size < 0, ERR_INVALID_PARAMETER);
+		if (spilled) {
+			if (p_size == 0) {
+				// Going back to inline storage frees the heap buffer.
+				heap.clear();
+				spilled = false;
+				return OK;
+			}
+			return heap.resize(p_size);
+		}
+		if (p_size > (Size)INLINE_CAPACITY) {
+			return _spill(p_size);
+		}
+		if (p_size < inline_size) {
+			_destroy_inline(p_size);
+		} else {
+			T *data = _get_inline();
+			for (Size i = inline_size; i < p_size; i++) {
+				memnew_placement(&data[i], T);
+			}
+			inline_size = p_size;
+		}
+		return OK;
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+
+	// Must take a copy instead of a reference (see GH-31736).
+	bool push_back(T p_elem) {
+		Error err = resize(size() + 1);
+		ERR_FAIL_COND_V(err, true);
+		ptrw()[size() - 1] = std::move(p_elem);
+		return false;
+	}
+	_FORCE_INLINE_ bool append(const T &p_elem) { return push_back(p_elem); } //alias
+
+	// Must take a copy instead of a reference (see GH-31736).
+	Error insert(Size p_pos, T p_val) {
+		Size len = size();
+		ERR_FAIL_INDEX_V(p_pos, len + 1, ERR_INVALID_PARAMETER);
+		Error err = resize(len + 1);
+		ERR_FAIL_COND_V(err, err);
+
+		T *data = ptrw();
+		for (Size i = len; i > p_pos; i--) {
+			data[i] = std::move(data[i - 1]);
+		}
+		data[p_pos] = std::move(p_val);
+		return OK;
+	}
+
+	void remove_at(Size p_index) {
+		Size len = size();
+		ERR_FAIL_INDEX(p_index, len);
+
+		T *data = ptrw();
+		for (Size i = p_index; i < len - 1; i++) {
+			data[i] = std::move(data[i + 1]);
+		}
+		resize(len - 1);
+	}
+
+	Size find(const T &p_val, Size p_from = 0) const {
+		const T *data = ptr();
+		for (Size i = MAX(p_from, (Size)0); i < size(); i++) {
+			if (data[i] == p_val) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	_FORCE_INLINE_ bool has(const T &p_val) const { return find(p_val) != -1; }
+
+	_FORCE_INLINE_ bool erase(const T &p_val) {
+		Size idx = find(p_val);
+		if (idx >= 0) {
+			remove_at(idx);
+			return true;
+		}
+		return false;
+	}
+
+	void fill(T p_elem) {
+		T *data = ptrw();
+		for (Size i = 0; i < size(); i++) {
+			data[i] = p_elem;
+		}
+	}
+
+	void reverse() {
+		const Size len = size();
+		T *data = ptrw();
+		for (Size i = 0; i < len / 2; i++) {
+			SWAP(data[i], data[len - i - 1]);
+		}
+	}
+
+	// Must take a copy instead of a reference (see GH-31736).
+	void append_array(InlineVector p_other) {
+		const Size ds = p_other.size();
+		if (ds == 0) {
+			return;
+		}
+		const Size bs = size();
+		Error err = resize(bs + ds);
+		ERR_FAIL_COND(err);
+
+		T *data = ptrw();
+		const T *other = p_other.ptr();
+		for (Size i = 0; i < ds; ++i) {
+			data[bs + i] = other[i];
+		}
+	}
+
+	template <typename Comparator, bool Validate = SORT_ARRAY_VALIDATE_ENABLED, typename... Args>
+	void sort_custom(Args &&...args) {
+		Size len = size();
+		if (len == 0) {
+			return;
+		}
+
+		SortArray<T, Comparator, Validate> sorter{ args... };
+		sorter.sort(ptrw(), len);
+	}
+
+	template <typename Comparator, typename Value, typename... Args>
+	Size bsearch_custom(const Value &p_value, bool p_before, Args &&...args) const {
+		SearchArray<T, Comparator> search{ args... };
+		return search.bisect(ptr(), size(), p_value, p_before);
+	}
+
+	operator Vector<T>() const {
+		if (spilled) {
+			return heap;
+		}
+		Vector<T> ret;
+		ret.resize(inline_size);
+		T *w = ret.ptrw();
+		const T *data = _get_inline();
+		for (Size i = 0; i < inline_size; i++) {
+			w[i] = data[i];
+		}
+		return ret;
+	}
+
+	// The source might be owned by this vector (e.g. one of its elements), so it's copied before clearing.
+	void operator=(const InlineVector &p_from) {
+		if (this == &p_from) {
+			return;
+		}
+		InlineVector copy(p_from);
+		clear();
+		_move_from(std::move(copy));
+	}
+
+	void operator=(InlineVector &&p_from) {
+		if (this == &p_from) {
+			return;
+		}
+		clear();
+		_move_from(std::move(p_from));
+	}
+
+	void operator=(const Vector<T> &p_from) {
+		InlineVector copy(p_from);
+		clear();
+		_move_from(std::move(copy));
+	}
+
+	_FORCE_INLINE_ InlineVector() {}
+	_FORCE_INLINE_ InlineVector(const InlineVector &p_from) { _copy_from(p_from); }
+	_FORCE_INLINE_ InlineVector(InlineVector &&p_from) { _move_from(std::move(p_from)); }
+	InlineVector(const Vector<T> &p_from) {
+		if (p_from.size() > (Size)INLINE_CAPACITY) {
+			// Share the buffer, it's copy-on-write anyway.
+			heap = p_from;
+			spilled = true;
+			return;
+		}
+		resize(p_from.size());
+		T *data = _get_inline();
+		for (Size i = 0; i < inline_size; i++) {
+			data[i] = p_from[i];
+		}
+	}
+	InlineVector(std::initializer_list<T> p_init) {
+		Error err = resize(p_init.size());
+		ERR_FAIL_COND(err);
+
+		Size i = 0;
+		T *data = ptrw();
+		for (const T &element : p_init) {
+			data[i++] = element;
+		}
+	}
+
+	_FORCE_INLINE_ ~InlineVector() { _destroy_inline(0); }
+};
@@ -34,19 +34,24 @@
 #include "core/math/math_funcs.h"
 #include "core/object/script_language.h"
 #include "core/templates/hashfuncs.h"
+#include "core/templates/inline_vector.h"
 #include "core/templates/search_array.h"
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/dictionary.h"
 #include "core/variant/variant.h"
 
+// The C# glue reads the first fields, keep ArrayPrivate in InteropStructs.cs in sync.
 struct ArrayPrivate {
 	SafeRefCount refcount;
-	Vector<Variant> array;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
+	// Most arrays are small (function arguments, short literals), keep those free of heap allocations.
+	InlineVector<Variant, 4> array;
 	ContainerTypeValidate typed;
 };
 
+static_assert(sizeof(InlineVector<Variant, 4>) == 40 + sizeof(Variant) * 4, "InlineVariantVector in InteropStructs.cs expects the inline elements at offset 40.");
+
 void Array::_ref(const Array &p_from) const {
 	ArrayPrivate *_fp = p_from._p;
 
@@ -137,10 +142,10 @@ bool Array::recursive_equal(const Array &p_array, int recursion_count) const {
 	if (_p == p_array._p) {
 		return true;
 	}
-	const Vector<Variant> &a1 = _p->array;
-	const Vector<Variant> &a2 = p_array._p->array;
-	const int size = a1.size();
-	if (size != a2.size()) {
+	const Variant *a1 = _p->array.ptr();
+	const Variant *a2 = p_array._p->array.ptr();
+	const int size = _p->array.size();
+	if (size != p_array._p->array.size()) {
 		return false;
 	}
 
@@ -287,7 +292,7 @@ void Array::push_back(const Variant &p_value) {
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
 
-	Vector<Variant> validated_array = p_array._p->array;
+	InlineVector<Variant, 4> validated_array = p_array._p->array;
 	for (int i = 0; i < validated_array.size(); ++i) {
 		ERR_FAIL_COND(!_p->typed.validate(validated_array.write[i], "append_array"));
 	}
@@ -299,7 +304,7 @@ Error Array::resize(int p_new_size) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
 	Variant::Type &variant_type = _p->typed.type;
 	int old_size = _p->array.size();
-	Error err = _p->array.resize_zeroed(p_new_size);
+	Error err = _p->array.resize(p_new_size);
 	if (!err && variant_type != Variant::NIL && variant_type != Variant::OBJECT) {
 		for (int i = old_size; i < p_new_size; i++) {
 			VariantInternal::initialize(&_p->array.write[i], variant_type);
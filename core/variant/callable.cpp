@@ -33,6 +33,7 @@
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/callable_bind.h"
 #include "core/variant/variant_callable.h"
 
@@ -123,12 +124,7 @@ Error Callable::rpcp(int p_id, const Variant **p_arguments, int p_argcount, Call
 }
 
 Callable Callable::bindp(const Variant **p_arguments, int p_argcount) const {
-	Vector<Variant> args;
-	args.resize(p_argcount);
-	for (int i = 0; i < p_argcount; i++) {
-		args.write[i] = *p_arguments[i];
-	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(memnew(CallableCustomBind(*this, p_arguments, p_argcount)));
 }
 
 Callable Callable::bindv(const Array &p_arguments) {
@@ -136,12 +132,20 @@ Callable Callable::bindv(const Array &p_arguments) {
 		return *this; // No point in creating a new callable if nothing is bound.
 	}
 
-	Vector<Variant> args;
-	args.resize(p_arguments.size());
-	for (int i = 0; i < p_arguments.size(); i++) {
-		args.write[i] = p_arguments[i];
+	// The argument count comes from script, only keep small argument lists on the stack.
+	constexpr int MAX_STACK_ARGS = 16;
+	const int argcount = p_arguments.size();
+	const Variant *stack_args[MAX_STACK_ARGS];
+	LocalVector<const Variant *> heap_args;
+	const Variant **args = stack_args;
+	if (argcount > MAX_STACK_ARGS) {
+		heap_args.resize(argcount);
+		args = heap_args.ptr();
+	}
+	for (int i = 0; i < argcount; i++) {
+		args[i] = &p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(memnew(CallableCustomBind(*this, args, argcount)));
 }
 
 Callable Callable::unbind(int p_argcount) const {
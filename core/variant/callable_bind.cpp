@@ -167,6 +167,15 @@ CallableCustomBind::CallableCustomBind(const Callable &p_callable, const Vector<
 	binds = p_binds;
 }
 
+CallableCustomBind::CallableCustomBind(const Callable &p_callable, const Variant **p_binds, int p_bind_count) {
+	callable = p_callable;
+	binds.resize(p_bind_count);
+	Variant *w = binds.ptrw();
+	for (int i = 0; i < p_bind_count; i++) {
+		w[i] = *p_binds[i];
+	}
+}
+
 CallableCustomBind::~CallableCustomBind() {
 }
 
@@ -30,12 +30,13 @@
 
 #pragma once
 
+#include "core/templates/inline_vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/variant.h"
 
 class CallableCustomBind : public CallableCustom {
 	Callable callable;
-	Vector<Variant> binds;
+	InlineVector<Variant, 4> binds;
 
 	static bool _equal_func(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool _less_func(const CallableCustom *p_a, const CallableCustom *p_b);
@@ -60,6 +61,7 @@ public:
 	Vector<Variant> get_binds() { return binds; }
 
 	CallableCustomBind(const Callable &p_callable, const Vector<Variant> &p_binds);
+	CallableCustomBind(const Callable &p_callable, const Variant **p_binds, int p_bind_count);
 	virtual ~CallableCustomBind();
 };
 
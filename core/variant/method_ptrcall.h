@@ -91,6 +91,9 @@ struct PtrToArg {};
 		_FORCE_INLINE_ static void encode(const m_type &p_val, void *p_ptr) { \
 			*((m_type *)p_ptr) = p_val;                                       \
 		}                                                                     \
+		_FORCE_INLINE_ static void encode(m_type &&p_val, void *p_ptr) {      \
+			*((m_type *)p_ptr) = std::move(p_val);                            \
+		}                                                                     \
 	};                                                                        \
 	template <>                                                               \
 	struct PtrToArg<const m_type &> {                                         \
@@ -101,6 +104,9 @@ struct PtrToArg {};
 		_FORCE_INLINE_ static void encode(const m_type &p_val, void *p_ptr) { \
 			*((m_type *)p_ptr) = p_val;                                       \
 		}                                                                     \
+		_FORCE_INLINE_ static void encode(m_type &&p_val, void *p_ptr) {      \
+			*((m_type *)p_ptr) = std::move(p_val);                            \
+		}                                                                     \
 	}
 
 MAKE_PTRARGCONV(bool, uint8_t);
@@ -142,16 +148,16 @@ MAKE_PTRARG(Callable);
 MAKE_PTRARG(Signal);
 MAKE_PTRARG(Dictionary);
 MAKE_PTRARG(Array);
-MAKE_PTRARG(PackedByteArray);
-MAKE_PTRARG(PackedInt32Array);
-MAKE_PTRARG(PackedInt64Array);
-MAKE_PTRARG(PackedFloat32Array);
-MAKE_PTRARG(PackedFloat64Array);
-MAKE_PTRARG(PackedStringArray);
-MAKE_PTRARG(PackedVector2Array);
-MAKE_PTRARG(PackedVector3Array);
-MAKE_PTRARG(PackedColorArray);
-MAKE_PTRARG(PackedVector4Array);
+MAKE_PTRARG_BY_REFERENCE(PackedByteArray);
+MAKE_PTRARG_BY_REFERENCE(PackedInt32Array);
+MAKE_PTRARG_BY_REFERENCE(PackedInt64Array);
+MAKE_PTRARG_BY_REFERENCE(PackedFloat32Array);
+MAKE_PTRARG_BY_REFERENCE(PackedFloat64Array);
+MAKE_PTRARG_BY_REFERENCE(PackedStringArray);
+MAKE_PTRARG_BY_REFERENCE(PackedVector2Array);
+MAKE_PTRARG_BY_REFERENCE(PackedVector3Array);
+MAKE_PTRARG_BY_REFERENCE(PackedColorArray);
+MAKE_PTRARG_BY_REFERENCE(PackedVector4Array);
 MAKE_PTRARG_BY_REFERENCE(Variant);
 
 // This is for Object.
@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -667,6 +668,37 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		p_instance->set(p_index, p_value);                                                                      \
 	}
 
+#define VARCALL_PACKED_ARRAY_MATH(m_packed_type, m_type, m_weight_type)                                                              \
+	static void func_##m_packed_type##_multiply_add(m_packed_type *p_instance, const m_type &p_multiplier, const m_type &p_addend) { \
+		PackedMath::multiply_add(p_instance->ptrw(), p_instance->size(), p_multiplier, p_addend);                                    \
+	}                                                                                                                                \
+	static void func_##m_packed_type##_add_elements(m_packed_type *p_instance, const m_packed_type &p_values) {                      \
+		ERR_FAIL_COND_MSG(p_values.size() != p_instance->size(), "Array sizes don't match.");                                        \
+		PackedMath::add(p_instance->ptrw(), p_values.ptr(), p_instance->size());                                                     \
+	}                                                                                                                                \
+	static void func_##m_packed_type##_multiply_elements(m_packed_type *p_instance, const m_packed_type &p_values) {                 \
+		ERR_FAIL_COND_MSG(p_values.size() != p_instance->size(), "Array sizes don't match.");                                        \
+		PackedMath::multiply(p_instance->ptrw(), p_values.ptr(), p_instance->size());                                                \
+	}                                                                                                                                \
+	static void func_##m_packed_type##_lerp(m_packed_type *p_instance, const m_packed_type &p_to, double p_weight) {                 \
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Array sizes don't match.");                                            \
+		PackedMath::lerp(p_instance->ptrw(), p_to.ptr(), p_instance->size(), (m_weight_type)p_weight);                               \
+	}                                                                                                                                \
+	static void func_##m_packed_type##_clamp(m_packed_type *p_instance, const m_type &p_min, const m_type &p_max) {                  \
+		PackedMath::clamp(p_instance->ptrw(), p_instance->size(), p_min, p_max);                                                     \
+	}
+
+#define VARCALL_PACKED_ARRAY_REDUCE(m_packed_type, m_type)                \
+	static m_type func_##m_packed_type##_sum(m_packed_type *p_instance) { \
+		return PackedMath::sum(p_instance->ptr(), p_instance->size());    \
+	}                                                                     \
+	static m_type func_##m_packed_type##_min(m_packed_type *p_instance) { \
+		return PackedMath::min(p_instance->ptr(), p_instance->size());    \
+	}                                                                     \
+	static m_type func_##m_packed_type##_max(m_packed_type *p_instance) { \
+		return PackedMath::max(p_instance->ptr(), p_instance->size());    \
+	}
+
 struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedByteArray, uint8_t)
 	VARCALL_ARRAY_GETTER_SETTER(PackedColorArray, Color)
@@ -680,6 +712,18 @@ struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedVector4Array, Vector4)
 	VARCALL_ARRAY_GETTER_SETTER(Array, Variant)
 
+	VARCALL_PACKED_ARRAY_MATH(PackedFloat32Array, float, float)
+	VARCALL_PACKED_ARRAY_MATH(PackedFloat64Array, double, double)
+	VARCALL_PACKED_ARRAY_MATH(PackedVector3Array, Vector3, real_t)
+	VARCALL_PACKED_ARRAY_MATH(PackedColorArray, Color, float)
+	VARCALL_PACKED_ARRAY_REDUCE(PackedFloat32Array, float)
+	VARCALL_PACKED_ARRAY_REDUCE(PackedFloat64Array, double)
+	VARCALL_PACKED_ARRAY_REDUCE(PackedVector3Array, Vector3)
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		PackedMath::transform(p_instance->ptrw(), p_instance->size(), p_transform);
+	}
+
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
 		if (p_instance->size() > 0) {
@@ -2562,6 +2606,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat32Array, multiply_add, _VariantCall::func_PackedFloat32Array_multiply_add, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat32Array, add_elements, _VariantCall::func_PackedFloat32Array_add_elements, sarray("values"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_elements, _VariantCall::func_PackedFloat32Array_multiply_elements, sarray("values"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloat32Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2585,6 +2638,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat64Array, multiply_add, _VariantCall::func_PackedFloat64Array_multiply_add, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat64Array, add_elements, _VariantCall::func_PackedFloat64Array_add_elements, sarray("values"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_elements, _VariantCall::func_PackedFloat64Array_multiply_elements, sarray("values"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedFloat64Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloat64Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloat64Array_sum, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloat64Array_min, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloat64Array_max, sarray(), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
@@ -2654,6 +2716,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedVector3Array, multiply_add, _VariantCall::func_PackedVector3Array_multiply_add, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedVector3Array, add_elements, _VariantCall::func_PackedVector3Array_add_elements, sarray("values"), varray());
+	bind_functionnc(PackedVector3Array, multiply_elements, _VariantCall::func_PackedVector3Array_multiply_elements, sarray("values"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedVector3Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, clamp, _VariantCall::func_PackedVector3Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
+	bind_function(PackedVector3Array, min, _VariantCall::func_PackedVector3Array_min, sarray(), varray());
+	bind_function(PackedVector3Array, max, _VariantCall::func_PackedVector3Array_max, sarray(), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
@@ -2677,6 +2749,12 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedColorArray, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedColorArray, count, sarray("value"), varray());
 
+	bind_functionnc(PackedColorArray, multiply_add, _VariantCall::func_PackedColorArray_multiply_add, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedColorArray, add_elements, _VariantCall::func_PackedColorArray_add_elements, sarray("values"), varray());
+	bind_functionnc(PackedColorArray, multiply_elements, _VariantCall::func_PackedColorArray_multiply_elements, sarray("values"), varray());
+	bind_functionnc(PackedColorArray, lerp, _VariantCall::func_PackedColorArray_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedColorArray, clamp, _VariantCall::func_PackedColorArray_clamp, sarray("min", "max"), varray());
+
 	/* Vector4 Array */
 
 	bind_method(PackedVector4Array, size, sarray(), varray());
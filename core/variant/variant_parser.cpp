@@ -273,7 +273,9 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				// Characters are collected as read; in UTF-8 streams these are bytes, decoded once at the end.
+				StringBuffer<> str;
+				bool ascii = true;
 				char32_t prev = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
@@ -376,7 +378,17 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						if (res >= 0x80 && p_stream->is_utf8()) {
+							// Keep the buffer all bytes, so escaped characters survive the decoding below.
+							CharString utf8 = String::chr(res).utf8();
+							for (int j = 0; j < utf8.length(); j++) {
+								str += (uint8_t)utf8[j];
+							}
+							ascii = false;
+						} else {
+							ascii = ascii && res < 0x80;
+							str += res;
+						}
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -386,6 +398,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
+						ascii = ascii && ch < 0x80;
 						str += ch;
 					}
 				}
@@ -395,15 +408,16 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
-				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+				String result = str.as_string();
+				if (!ascii && p_stream->is_utf8()) {
+					result.parse_utf8(result.ascii(true).get_data());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
-					r_token.value = StringName(str);
+					r_token.value = StringName(result);
 				} else {
 					r_token.type = TK_STRING;
-					r_token.value = str;
+					r_token.value = result;
 				}
 				return OK;
 
@@ -544,8 +558,26 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+// Skips whitespace inside constructor argument lists, returning the next character.
+static char32_t _skip_construct_whitespace(VariantParser::Stream *p_stream, int &line) {
+	char32_t c;
+	if (p_stream->saved) {
+		c = p_stream->saved;
+		p_stream->saved = 0;
+	} else {
+		c = p_stream->get_char();
+	}
+	while (c != 0 && c <= 32) {
+		if (c == '\n') {
+			line++;
+		}
+		c = p_stream->get_char();
+	}
+	return c;
+}
+
 template <typename T>
-Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
+Error VariantParser::_parse_construct(Stream *p_stream, LocalVector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
 	get_token(p_stream, token, line, r_err_str);
 	if (token.type != TK_PARENTHESIS_OPEN) {
@@ -553,40 +585,57 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Packed arrays can hold many thousands of numbers, so they are scanned straight from the
+	// stream and converted in place instead of going through get_token() and Variant for each one.
 	bool first = true;
 	while (true) {
+		char32_t c = _skip_construct_whitespace(p_stream, line);
 		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
+			if (c == ')') {
 				break;
-			} else {
+			} else if (c != ',') {
 				r_err_str = "Expected ',' or ')' in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			c = _skip_construct_whitespace(p_stream, line);
+		} else if (c == ')') {
+			break;
 		}
-		get_token(p_stream, token, line, r_err_str);
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
-			break;
-		} else if (token.type != TK_NUMBER) {
-			bool valid = false;
-			if (token.type == TK_IDENTIFIER) {
-				double real = stor_fix(token.value);
-				if (real != -1) {
-					token.type = TK_NUMBER;
-					token.value = real;
-					valid = true;
-				}
+		StringBuffer<> text;
+		bool is_number = true;
+		bool is_float = false;
+		bool has_digits = false;
+		while (is_ascii_alphanumeric_char(c) || c == '-' || c == '+' || c == '.' || c == '_') {
+			if (is_digit(c)) {
+				has_digits = true;
+			} else if (c == '-' && text.length() == 0) {
+				// Sign.
+			} else if (has_digits && (c == '.' || c == 'e' || c == 'E')) {
+				is_float = true;
+			} else if (!(has_digits && is_float && (c == '-' || c == '+'))) {
+				is_number = false;
+			}
+			text += c;
+			c = p_stream->get_char();
+		}
+		p_stream->saved = c;
+
+		if (is_number && has_digits) {
+			if (is_float) {
+				r_construct.push_back(T(text.as_double()));
+			} else {
+				r_construct.push_back(T(text.as_int()));
 			}
-			if (!valid) {
+		} else {
+			// Not a plain number, inf and nan are written as identifiers.
+			double real = text.length() ? stor_fix(text.as_string()) : -1;
+			if (real == -1) {
 				r_err_str = "Expected float in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			r_construct.push_back(T(real));
 		}
-
-		r_construct.push_back(token.value);
 		first = false;
 	}
 
@@ -702,7 +751,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 		} else if (id == "nan") {
 			value = NAN;
 		} else if (id == "Vector2") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -715,7 +764,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector2(args[0], args[1]);
 		} else if (id == "Vector2i") {
-			Vector<int32_t> args;
+			LocalVector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -728,7 +777,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector2i(args[0], args[1]);
 		} else if (id == "Rect2") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -741,7 +790,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Rect2(args[0], args[1], args[2], args[3]);
 		} else if (id == "Rect2i") {
-			Vector<int32_t> args;
+			LocalVector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -754,7 +803,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Rect2i(args[0], args[1], args[2], args[3]);
 		} else if (id == "Vector3") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -767,7 +816,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector3(args[0], args[1], args[2]);
 		} else if (id == "Vector3i") {
-			Vector<int32_t> args;
+			LocalVector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -780,7 +829,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector3i(args[0], args[1], args[2]);
 		} else if (id == "Vector4") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -793,7 +842,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector4(args[0], args[1], args[2], args[3]);
 		} else if (id == "Vector4i") {
-			Vector<int32_t> args;
+			LocalVector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -806,7 +855,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Vector4i(args[0], args[1], args[2], args[3]);
 		} else if (id == "Transform2D" || id == "Matrix32") { //compatibility
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -823,7 +872,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 			m[2] = Vector2(args[4], args[5]);
 			value = m;
 		} else if (id == "Plane") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -836,7 +885,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Plane(args[0], args[1], args[2], args[3]);
 		} else if (id == "Quaternion" || id == "Quat") { // "Quat" kept for compatibility
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -849,7 +898,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Quaternion(args[0], args[1], args[2], args[3]);
 		} else if (id == "AABB" || id == "Rect3") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -862,7 +911,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = AABB(Vector3(args[0], args[1], args[2]), Vector3(args[3], args[4], args[5]));
 		} else if (id == "Basis" || id == "Matrix3") { //compatibility
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -875,7 +924,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Basis(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], args[8]);
 		} else if (id == "Transform3D" || id == "Transform") { // "Transform" kept for compatibility with Godot <4.
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -888,7 +937,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Transform3D(Basis(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], args[8]), Vector3(args[9], args[10], args[11]));
 		} else if (id == "Projection") { // "Transform" kept for compatibility with Godot <4.
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -901,7 +950,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = Projection(Vector4(args[0], args[1], args[2], args[3]), Vector4(args[4], args[5], args[6], args[7]), Vector4(args[8], args[9], args[10], args[11]), Vector4(args[12], args[13], args[14], args[15]));
 		} else if (id == "Color") {
-			Vector<float> args;
+			LocalVector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1380,7 +1429,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
-			Vector<int32_t> args;
+			LocalVector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1398,7 +1447,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedInt64Array") {
-			Vector<int64_t> args;
+			LocalVector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1416,7 +1465,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
-			Vector<float> args;
+			LocalVector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1434,7 +1483,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedFloat64Array") {
-			Vector<double> args;
+			LocalVector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1498,7 +1547,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedVector2Array" || id == "PoolVector2Array" || id == "Vector2Array") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1516,7 +1565,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedVector3Array" || id == "PoolVector3Array" || id == "Vector3Array") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1534,7 +1583,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedVector4Array" || id == "PoolVector4Array" || id == "Vector4Array") {
-			Vector<real_t> args;
+			LocalVector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -1552,7 +1601,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedColorArray" || id == "PoolColorArray" || id == "ColorArray") {
-			Vector<float> args;
+			LocalVector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
 			if (err) {
 				return err;
@@ -0,0 +1,464 @@
+/**************************************************************************/
+/*  async_file_io_unix.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "async_file_io_unix.h"
+
+#if defined(UNIX_ENABLED)
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(THREADS_ENABLED) && __has_include(<linux/io_uring.h>)
+#include <linux/version.h>
+// IORING_OP_READ and fadvise_advice first appeared in the 5.6 headers.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+#define IO_URING_ENABLED
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+// Reads are split so each one fits the 32-bit length of a submission.
+static constexpr uint64_t CHUNK_SIZE = 1 << 30;
+
+struct AsyncReadRequest {
+	int fd = -1;
+	uint64_t position = 0;
+	uint8_t *dst = nullptr;
+	uint64_t length = 0;
+	uint64_t done = 0;
+	uint32_t chunk = 0;
+	FileAccess::AsyncReadCallback callback = nullptr;
+	void *userdata = nullptr;
+};
+
+static void _complete(AsyncReadRequest *p_request, int64_t p_read) {
+	if (p_request->callback) {
+		p_request->callback(p_request->userdata, p_read);
+	}
+	memdelete(p_request);
+}
+
+static void _pool_process(AsyncReadRequest *p_request) {
+	while (p_request->done < p_request->length) {
+		uint64_t remaining = p_request->length - p_request->done;
+		uint64_t chunk = MIN(remaining, CHUNK_SIZE);
+		if (!p_request->dst) {
+#ifdef POSIX_FADV_WILLNEED
+			posix_fadvise(p_request->fd, p_request->position + p_request->done, chunk, POSIX_FADV_WILLNEED);
+#endif
+			p_request->done += chunk;
+			continue;
+		}
+
+		ssize_t read = pread(p_request->fd, p_request->dst + p_request->done, chunk, p_request->position + p_request->done);
+		if (read < 0) {
+			if (errno == EINTR || errno == EAGAIN) {
+				continue;
+			}
+			_complete(p_request, p_request->done > 0 ? (int64_t)p_request->done : -1);
+			return;
+		}
+		if (read == 0) {
+			break; // End of file.
+		}
+		p_request->done += read;
+	}
+	_complete(p_request, p_request->done);
+}
+
+#ifdef THREADS_ENABLED
+// Blocking reads for when there is no ring, few since they mostly wait on the same disk.
+static constexpr int POOL_THREADS = 2;
+static Thread *pool_threads = nullptr;
+static List<AsyncReadRequest *> pool_queue;
+static BinaryMutex pool_mutex;
+static Semaphore pool_semaphore;
+static bool pool_exiting = false;
+
+static void _pool_thread_func(void *p_userdata) {
+	while (true) {
+		pool_semaphore.wait();
+
+		AsyncReadRequest *request = nullptr;
+		{
+			MutexLock lock(pool_mutex);
+			if (pool_queue.is_empty()) {
+				if (pool_exiting) {
+					return;
+				}
+				continue;
+			}
+			request = pool_queue.front()->get();
+			pool_queue.pop_front();
+		}
+		_pool_process(request);
+	}
+}
+#endif // THREADS_ENABLED
+
+static void _pool_push(AsyncReadRequest *p_request) {
+#ifdef THREADS_ENABLED
+	{
+		MutexLock lock(pool_mutex);
+		if (!pool_threads) {
+			pool_threads = memnew_arr(Thread, POOL_THREADS);
+			for (int i = 0; i < POOL_THREADS; i++) {
+				pool_threads[i].start(&_pool_thread_func, nullptr);
+			}
+		}
+		pool_queue.push_back(p_request);
+	}
+	pool_semaphore.post();
+#else
+	// Nothing to run it on, the read completes before returning.
+	_pool_process(p_request);
+#endif
+}
+
+#ifdef IO_URING_ENABLED
+
+struct AsyncReadRing {
+	int fd = -1;
+
+	void *sq_map = nullptr;
+	size_t sq_map_size = 0;
+	void *cq_map = nullptr;
+	size_t cq_map_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+
+	uint32_t *sq_head = nullptr;
+	uint32_t *sq_tail = nullptr;
+	uint32_t *sq_array = nullptr;
+	uint32_t sq_mask = 0;
+	uint32_t sq_entries = 0;
+
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	io_uring_cqe *cqes = nullptr;
+	uint32_t cq_mask = 0;
+	uint32_t cq_entries = 0;
+
+	// Guards submissions and the counters below.
+	BinaryMutex mutex;
+	// Submitted and not reaped yet, kept under cq_entries so completions are never dropped.
+	uint32_t in_flight = 0;
+	// Queued in the ring but not accepted by the kernel yet.
+	uint32_t unsubmitted = 0;
+	bool exiting = false;
+
+	Thread thread;
+};
+
+static constexpr uint32_t RING_ENTRIES = 64;
+
+static AsyncReadRing *ring = nullptr;
+static bool ring_initialized = false;
+static BinaryMutex ring_init_mutex;
+// Set when the kernel has a ring but not the read operations (before Linux 5.6).
+static SafeFlag ring_unsupported;
+
+static void _ring_thread_func(void *p_userdata);
+
+static int _io_uring_enter(int p_fd, uint32_t p_to_submit, uint32_t p_min_complete, uint32_t p_flags) {
+	return syscall(__NR_io_uring_enter, p_fd, p_to_submit, p_min_complete, p_flags, nullptr, 0);
+}
+
+static bool _ring_init() {
+	MutexLock lock(ring_init_mutex);
+	if (ring_initialized) {
+		return ring != nullptr;
+	}
+	ring_initialized = true;
+
+	io_uring_params params = {};
+	int fd = syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+	if (fd < 0) {
+		// Not built in, or denied by a sandbox.
+		return false;
+	}
+
+	AsyncReadRing *r = memnew(AsyncReadRing);
+	r->fd = fd;
+	r->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	r->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	bool single_map = params.features & IORING_FEAT_SINGLE_MMAP;
+	if (single_map) {
+		r->sq_map_size = MAX(r->sq_map_size, r->cq_map_size);
+	}
+
+	r->sq_map = mmap(nullptr, r->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (single_map) {
+		r->cq_map = r->sq_map;
+	} else if (r->sq_map != MAP_FAILED) {
+		r->cq_map = mmap(nullptr, r->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+	}
+	r->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+	if (r->sq_map != MAP_FAILED && r->cq_map != MAP_FAILED) {
+		r->sqes = (io_uring_sqe *)mmap(nullptr, r->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	}
+	if (r->sq_map == MAP_FAILED || r->cq_map == MAP_FAILED || r->sqes == MAP_FAILED) {
+		if (r->sq_map != MAP_FAILED) {
+			munmap(r->sq_map, r->sq_map_size);
+		}
+		if (!single_map && r->cq_map && r->cq_map != MAP_FAILED) {
+			munmap(r->cq_map, r->cq_map_size);
+		}
+		close(fd);
+		memdelete(r);
+		return false;
+	}
+
+	uint8_t *sq = (uint8_t *)r->sq_map;
+	r->sq_head = (uint32_t *)(sq + params.sq_off.head);
+	r->sq_tail = (uint32_t *)(sq + params.sq_off.tail);
+	r->sq_array = (uint32_t *)(sq + params.sq_off.array);
+	r->sq_mask = *(uint32_t *)(sq + params.sq_off.ring_mask);
+	r->sq_entries = params.sq_entries;
+
+	uint8_t *cq = (uint8_t *)r->cq_map;
+	r->cq_head = (uint32_t *)(cq + params.cq_off.head);
+	r->cq_tail = (uint32_t *)(cq + params.cq_off.tail);
+	r->cqes = (io_uring_cqe *)(cq + params.cq_off.cqes);
+	r->cq_mask = *(uint32_t *)(cq + params.cq_off.ring_mask);
+	r->cq_entries = params.cq_entries;
+
+	ring = r;
+	ring->thread.start(&_ring_thread_func, nullptr);
+	return true;
+}
+
+static bool _ring_submit(AsyncReadRequest *p_request) {
+	MutexLock lock(ring->mutex);
+
+	uint32_t tail = *ring->sq_tail;
+	uint32_t head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+	if (ring->exiting || ring->in_flight >= ring->cq_entries || tail - head >= ring->sq_entries) {
+		return false;
+	}
+
+	uint32_t index = tail & ring->sq_mask;
+	io_uring_sqe *sqe = &ring->sqes[index];
+	memset(sqe, 0, sizeof(io_uring_sqe));
+	sqe->user_data = (uint64_t)(uintptr_t)p_request;
+	if (p_request) {
+		sqe->fd = p_request->fd;
+		sqe->off = p_request->position + p_request->done;
+		p_request->chunk = MIN(p_request->length - p_request->done, CHUNK_SIZE);
+		sqe->len = p_request->chunk;
+		if (p_request->dst) {
+			sqe->opcode = IORING_OP_READ;
+			sqe->addr = (uint64_t)(uintptr_t)(p_request->dst + p_request->done);
+		} else {
+			sqe->opcode = IORING_OP_FADVISE;
+			sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+		}
+	} else {
+		// Wakes the completion thread up to exit.
+		sqe->opcode = IORING_OP_NOP;
+	}
+	ring->sq_array[index] = index;
+	__atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	ring->in_flight++;
+	ring->unsubmitted++;
+
+	int submitted;
+	do {
+		submitted = _io_uring_enter(ring->fd, ring->unsubmitted, 0, 0);
+	} while (submitted < 0 && errno == EINTR);
+	// On a transient failure the entry stays in the ring, and goes with the next submission.
+	if (submitted > 0) {
+		ring->unsubmitted -= submitted;
+	}
+	return true;
+}
+
+static void _ring_thread_func(void *p_userdata) {
+	struct Completion {
+		AsyncReadRequest *request = nullptr;
+		int32_t result = 0;
+	};
+	LocalVector<Completion> completions;
+	bool exiting = false;
+
+	while (true) {
+		_io_uring_enter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS);
+
+		uint32_t head = *ring->cq_head;
+		uint32_t tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+		uint32_t reaped = tail - head;
+		for (; head != tail; head++) {
+			const io_uring_cqe &cqe = ring->cqes[head & ring->cq_mask];
+			AsyncReadRequest *request = (AsyncReadRequest *)(uintptr_t)cqe.user_data;
+			if (request) {
+				completions.push_back({ request, cqe.res });
+			} else {
+				exiting = true;
+			}
+		}
+		__atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+		{
+			MutexLock lock(ring->mutex);
+			ring->in_flight -= reaped;
+		}
+
+		for (const Completion &completion : completions) {
+			AsyncReadRequest *request = completion.request;
+			int32_t result = completion.result;
+			if (result == -EINTR || result == -EAGAIN) {
+				// Try again as is.
+			} else if (result == -EINVAL || result == -EOPNOTSUPP) {
+				if (request->done == 0) {
+					ring_unsupported.set();
+					_pool_push(request);
+					continue;
+				}
+				_complete(request, request->done);
+				continue;
+			} else if (result < 0) {
+				_complete(request, request->done > 0 ? (int64_t)request->done : -1);
+				continue;
+			} else if (request->dst) {
+				request->done += result;
+				if (result == 0 || request->done == request->length) {
+					_complete(request, request->done);
+					continue;
+				}
+			} else {
+				request->done += request->chunk;
+				if (request->done == request->length) {
+					_complete(request, request->done);
+					continue;
+				}
+			}
+			if (!_ring_submit(request)) {
+				_pool_push(request);
+			}
+		}
+		completions.clear();
+
+		if (exiting) {
+			MutexLock lock(ring->mutex);
+			if (ring->in_flight == 0) {
+				return;
+			}
+		}
+	}
+}
+
+#endif // IO_URING_ENABLED
+
+bool AsyncFileIOUnix::read(int p_fd, uint64_t p_position, uint8_t *p_dst, uint64_t p_length, FileAccess::AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_COND_V(p_fd < 0, false);
+
+	AsyncReadRequest *request = memnew(AsyncReadRequest);
+	request->fd = p_fd;
+	request->position = p_position;
+	request->dst = p_dst;
+	request->length = p_length;
+	request->callback = p_callback;
+	request->userdata = p_userdata;
+
+	if (p_length == 0) {
+		_complete(request, 0);
+		return true;
+	}
+
+#ifdef IO_URING_ENABLED
+	if (!ring_unsupported.is_set() && _ring_init() && _ring_submit(request)) {
+		return true;
+	}
+#endif
+	_pool_push(request);
+	return true;
+}
+
+void AsyncFileIOUnix::finish() {
+#ifdef IO_URING_ENABLED
+	{
+		MutexLock lock(ring_init_mutex);
+		if (ring) {
+			// Queued behind whatever is still in flight, the thread exits once all of it is reaped.
+			while (!_ring_submit(nullptr)) {
+				OS::get_singleton()->delay_usec(1000);
+			}
+			{
+				MutexLock ring_lock(ring->mutex);
+				ring->exiting = true;
+			}
+			ring->thread.wait_to_finish();
+
+			munmap(ring->sqes, ring->sqes_size);
+			if (ring->cq_map != ring->sq_map) {
+				munmap(ring->cq_map, ring->cq_map_size);
+			}
+			munmap(ring->sq_map, ring->sq_map_size);
+			close(ring->fd);
+			memdelete(ring);
+			ring = nullptr;
+		}
+		ring_initialized = false;
+	}
+#endif
+
+#ifdef THREADS_ENABLED
+	Thread *threads = nullptr;
+	{
+		MutexLock lock(pool_mutex);
+		threads = pool_threads;
+		pool_threads = nullptr;
+		pool_exiting = true;
+	}
+	if (threads) {
+		// The threads drain the queue before exiting.
+		pool_semaphore.post(POOL_THREADS);
+		for (int i = 0; i < POOL_THREADS; i++) {
+			threads[i].wait_to_finish();
+		}
+		memdelete_arr(threads);
+	}
+	pool_exiting = false;
+#endif
+}
+
+#endif // UNIX_ENABLED
@@ -34,9 +34,11 @@
 
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "drivers/unix/async_file_io_unix.h"
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -171,6 +173,9 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	mapping.unref();
+	map_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -276,6 +281,85 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+class FileMappingUnix : public FileMapping {
+public:
+	virtual void prefetch(uint64_t p_offset, uint64_t p_length) const override {
+		if (p_length == 0) {
+			return;
+		}
+		static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+		uintptr_t start = ((uintptr_t)data + p_offset) & ~(page_size - 1);
+		madvise((void *)start, (uintptr_t)data + p_offset + p_length - start, MADV_WILLNEED);
+	}
+
+	FileMappingUnix(const uint8_t *p_data, uint64_t p_size) {
+		data = p_data;
+		size = p_size;
+	}
+
+	~FileMappingUnix() {
+		munmap((void *)data, size);
+	}
+};
+
+Ref<FileMapping> FileAccessUnix::create_mapping() const {
+	ERR_FAIL_NULL_V_MSG(f, Ref<FileMapping>(), "File must be opened before use.");
+
+	if (flags != READ) {
+		// Writable files may change under the mapping.
+		return Ref<FileMapping>();
+	}
+
+	struct stat st;
+	int fd = fileno(f);
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+		return Ref<FileMapping>();
+	}
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) {
+		return Ref<FileMapping>();
+	}
+	return memnew(FileMappingUnix((const uint8_t *)data, st.st_size));
+}
+
+const uint8_t *FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (map_failed) {
+		return nullptr;
+	}
+	if (mapping.is_null()) {
+		mapping = create_mapping();
+		if (mapping.is_null()) {
+			map_failed = true;
+			return nullptr;
+		}
+	}
+
+	int64_t pos = ftello(f);
+	if (pos < 0 || (uint64_t)pos + p_length > mapping->get_size()) {
+		return nullptr;
+	}
+	if (fseeko(f, pos + p_length, SEEK_SET)) {
+		check_errors();
+		return nullptr;
+	}
+
+	// Start reading the pages in now, the caller is going to touch all of them.
+	mapping->prefetch(pos, p_length);
+	return mapping->get_data() + pos;
+}
+
+bool FileAccessUnix::read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_NULL_V_MSG(f, false, "File must be opened before use.");
+
+	if (flags != READ) {
+		// Reading from the descriptor would miss writes still buffered by stdio.
+		return false;
+	}
+	return AsyncFileIOUnix::read(fileno(f), p_position, p_dst, p_length, p_callback, p_userdata);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -40,6 +40,9 @@
 class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
+	// Created by the first get_buffer_view() call.
+	mutable Ref<FileMapping> mapping;
+	mutable bool map_failed = false;
 	void check_errors(bool p_write = false) const;
 	mutable Error last_error = OK;
 	String save_path;
@@ -70,6 +73,9 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
+	virtual Ref<FileMapping> create_mapping() const override;
+	virtual bool read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, AsyncReadCallback p_callback, void *p_userdata) override;
 
 	virtual Error get_error() const override; ///< get last error
 
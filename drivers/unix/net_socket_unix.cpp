@@ -508,6 +508,92 @@ Error NetSocketUnix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPA
 	return OK;
 }
 
+#ifdef __linux__
+Error NetSocketUnix::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	r_received = 0;
+	ERR_FAIL_COND_V(p_count <= 0, ERR_INVALID_PARAMETER);
+
+	const int count = MIN(p_count, (int)MMSG_BATCH_MAX);
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+	memset(msgs, 0, sizeof(struct mmsghdr) * count);
+	for (int i = 0; i < count; i++) {
+		iovs[i].iov_base = p_datagrams[i].buffer;
+		iovs[i].iov_len = p_datagrams[i].size;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	// Only wait for the first datagram when blocking.
+	int ret = ::recvmmsg(_sock, msgs, count, MSG_WAITFORONE, nullptr);
+
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK) {
+			return ERR_BUSY;
+		}
+
+		if (err == ERR_NET_BUFFER_TOO_SMALL) {
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		return FAILED;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		p_datagrams[i].size = msgs[i].msg_len;
+		_set_ip_port(&addrs[i], &p_datagrams[i].ip, &p_datagrams[i].port);
+	}
+	r_received = ret;
+
+	return OK;
+}
+
+Error NetSocketUnix::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	r_sent = 0;
+	ERR_FAIL_COND_V(p_count <= 0, ERR_INVALID_PARAMETER);
+
+	const int count = MIN(p_count, (int)MMSG_BATCH_MAX);
+	struct mmsghdr msgs[MMSG_BATCH_MAX];
+	struct iovec iovs[MMSG_BATCH_MAX];
+	struct sockaddr_storage addrs[MMSG_BATCH_MAX];
+	memset(msgs, 0, sizeof(struct mmsghdr) * count);
+	for (int i = 0; i < count; i++) {
+		size_t addr_size = _set_addr_storage(&addrs[i], p_datagrams[i].ip, p_datagrams[i].port, _ip_type);
+		ERR_FAIL_COND_V(addr_size == 0, ERR_INVALID_PARAMETER);
+		iovs[i].iov_base = p_datagrams[i].buffer;
+		iovs[i].iov_len = p_datagrams[i].size;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = addr_size;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	int ret = ::sendmmsg(_sock, msgs, count, 0);
+
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK) {
+			return ERR_BUSY;
+		}
+		if (err == ERR_NET_BUFFER_TOO_SMALL) {
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		return FAILED;
+	}
+
+	r_sent = ret;
+
+	return OK;
+}
+#endif // __linux__
+
 Error NetSocketUnix::set_broadcasting_enabled(bool p_enabled) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 	// IPv6 has no broadcast support.
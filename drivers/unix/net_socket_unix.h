@@ -57,6 +57,12 @@ private:
 	_FORCE_INLINE_ Error _change_multicast_group(IPAddress p_ip, String p_if_name, bool p_add);
 	_FORCE_INLINE_ void _set_close_exec_enabled(bool p_enabled);
 
+#ifdef __linux__
+	enum {
+		MMSG_BATCH_MAX = 64,
+	};
+#endif
+
 protected:
 	static NetSocket *_create_func();
 
@@ -79,6 +85,10 @@ public:
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent) override;
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) override;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) override;
+#ifdef __linux__
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) override;
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) override;
+#endif
 
 	virtual bool is_open() const override;
 	virtual int get_available_bytes() const override;
@@ -35,6 +35,7 @@
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
+#include "drivers/unix/async_file_io_unix.h"
 #include "drivers/unix/dir_access_unix.h"
 #include "drivers/unix/file_access_unix.h"
 #include "drivers/unix/file_access_unix_pipe.h"
@@ -177,6 +178,7 @@ void OS_Unix::initialize_core() {
 }
 
 void OS_Unix::finalize_core() {
+	AsyncFileIOUnix::finish();
 	memdelete(process_map);
 #ifndef UNIX_SOCKET_UNAVAILABLE
 	NetSocketUnix::cleanup();
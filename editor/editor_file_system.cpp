@@ -43,6 +43,7 @@
 #include "editor/editor_paths.h"
 #include "editor/editor_resource_preview.h"
 #include "editor/editor_settings.h"
+#include "editor/import/editor_import_cache.h"
 #include "editor/plugins/script_editor_plugin.h"
 #include "editor/project_settings_editor.h"
 #include "scene/resources/packed_scene.h"
@@ -245,7 +246,7 @@ void EditorFileSystem::_load_first_scan_root_dir() {
 	first_scan_root_dir = memnew(ScannedDirectory);
 	first_scan_root_dir->full_path = "res://";
 
-	nb_files_total = _scan_new_dir(first_scan_root_dir, d);
+	nb_files_total = _scan_new_dir_threaded(first_scan_root_dir, d);
 }
 
 void EditorFileSystem::scan_for_uid() {
@@ -510,7 +511,7 @@ void EditorFileSystem::_scan_filesystem() {
 		Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 		sd = memnew(ScannedDirectory);
 		sd->full_path = "res://";
-		nb_files_total = _scan_new_dir(sd, d);
+		nb_files_total = _scan_new_dir_threaded(sd, d);
 	}
 
 	_process_file_system(sd, new_filesystem, sp, processed_files);
@@ -570,7 +571,33 @@ bool EditorFileSystem::_is_test_for_reimport_needed(const String &p_path, uint64
 	return false;
 }
 
-bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_expected_import_md5) {
+void EditorFileSystem::_test_for_reimport_thread(void *p_userdata, uint32_t p_index) {
+	ReimportTest &test = ((ReimportTest *)p_userdata)[p_index];
+	if (!test.path.is_empty()) {
+		test.need_reimport = _test_for_reimport(test.path, test.import_md5, &test);
+	}
+}
+
+void EditorFileSystem::_test_for_reimport_parallel(LocalVector<ReimportTest> &p_tests) {
+	DEV_ASSERT(Thread::is_main_thread());
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&EditorFileSystem::_test_for_reimport_thread, p_tests.ptr(), p_tests.size(), -1, false, TTR("Check imported files"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Importers may compare their settings against editor state (e.g. the editor scale or theme),
+	// which is not safe to read from worker threads, so that check is done here.
+	for (ReimportTest &test : p_tests) {
+		if (test.importer.is_valid()) {
+			if (!test.need_reimport && !test.importer->are_import_settings_valid(test.path, test.import_metadata)) {
+				test.need_reimport = true;
+			}
+			test.importer.unref();
+			test.import_metadata = Variant();
+		}
+	}
+}
+
+bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_expected_import_md5, ReimportTest *r_deferred) {
 	if (p_expected_import_md5.is_empty()) {
 		// Marked as reimportation needed.
 		return true;
@@ -678,7 +705,11 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 		return true; // Version changed, reimport.
 	}
 
-	if (!importer->are_import_settings_valid(p_path, meta)) {
+	if (r_deferred) {
+		// Called from a worker thread, the caller checks the settings on the main thread.
+		r_deferred->importer = importer;
+		r_deferred->import_metadata = meta;
+	} else if (!importer->are_import_settings_valid(p_path, meta)) {
 		// Reimport settings are out of sync with project settings, reimport.
 		return true;
 	}
@@ -857,7 +888,31 @@ bool EditorFileSystem::_update_scan_actions() {
 		ep = memnew(EditorProgress("_update_scan_actions", TTR("Scanning actions..."), scan_actions.size()));
 	}
 
+	// Testing for reimport hashes the source and imported files, which dominates the first scan
+	// of a large project, so run all the tests on worker threads before applying the actions.
+	// Files that don't exist yet (added by an earlier action) are tested in order below.
+	LocalVector<ReimportTest> reimport_tests;
+	for (const ItemAction &ia : scan_actions) {
+		if (ia.action == ItemAction::ACTION_FILE_TEST_REIMPORT) {
+			ReimportTest test;
+			int idx = ia.dir->find_file_index(ia.file);
+			if (idx != -1) {
+				test.path = ia.dir->get_file_path(idx);
+				test.import_md5 = ia.dir->files[idx]->import_md5;
+			}
+			reimport_tests.push_back(test);
+		}
+	}
+
+	if (reimport_tests.size() > 1) {
+		if (ep) {
+			ep->step(TTR("Checking imported files..."), 0, false);
+		}
+		_test_for_reimport_parallel(reimport_tests);
+	}
+
 	int step_count = 0;
+	uint32_t reimport_test_index = 0;
 	for (const ItemAction &ia : scan_actions) {
 		switch (ia.action) {
 			case ItemAction::ACTION_NONE: {
@@ -952,11 +1007,17 @@ bool EditorFileSystem::_update_scan_actions() {
 
 			} break;
 			case ItemAction::ACTION_FILE_TEST_REIMPORT: {
+				const ReimportTest &test = reimport_tests[reimport_test_index++];
 				int idx = ia.dir->find_file_index(ia.file);
 				ERR_CONTINUE(idx == -1);
 				String full_path = ia.dir->get_file_path(idx);
 
-				bool need_reimport = _test_for_reimport(full_path, ia.dir->files[idx]->import_md5);
+				bool need_reimport;
+				if (reimport_tests.size() > 1 && test.path == full_path) {
+					need_reimport = test.need_reimport;
+				} else {
+					need_reimport = _test_for_reimport(full_path, ia.dir->files[idx]->import_md5);
+				}
 				if (need_reimport) {
 					// Must reimport.
 					reimports.push_back(full_path);
@@ -1105,7 +1166,7 @@ void EditorFileSystem::ScanProgress::increment() {
 	EditorFileSystem::singleton->scan_total = ratio;
 }
 
-int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+int EditorFileSystem::_list_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
 	List<String> dirs;
 	List<String> files;
 
@@ -1143,33 +1204,96 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	dirs.sort_custom<FileNoCaseComparator>();
 	files.sort_custom<FileNoCaseComparator>();
 
-	int nb_files_total_scan = 0;
-
 	for (List<String>::Element *E = dirs.front(); E; E = E->next()) {
 		if (da->change_dir(E->get()) == OK) {
 			String d = da->get_current_dir();
 
-			if (d == cd || !d.begins_with(cd)) {
-				da->change_dir(cd); //avoid recursion
-			} else {
+			if (d != cd && d.begins_with(cd)) {
 				ScannedDirectory *sd = memnew(ScannedDirectory);
 				sd->name = E->get();
 				sd->full_path = p_dir->full_path.path_join(sd->name);
-
-				nb_files_total_scan += _scan_new_dir(sd, da);
-
 				p_dir->subdirs.push_back(sd);
-
-				da->change_dir("..");
 			}
+			da->change_dir(cd); //avoid recursion
 		} else {
 			ERR_PRINT("Cannot go into subdir '" + E->get() + "'.");
 		}
 	}
 
 	p_dir->files = files;
-	nb_files_total_scan += files.size();
+	return files.size();
+}
+
+int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+	int nb_files_total_scan = _list_new_dir(p_dir, da);
+
+	for (ScannedDirectory *sd : p_dir->subdirs) {
+		if (da->change_dir(sd->full_path) == OK) {
+			nb_files_total_scan += _scan_new_dir(sd, da);
+		}
+	}
+
+	return nb_files_total_scan;
+}
 
+void EditorFileSystem::_scan_new_dir_thread(void *p_userdata, uint32_t p_index) {
+	ScanDirThreadData *data = static_cast<ScanDirThreadData *>(p_userdata);
+	ScannedDirectory *sd = data->dirs[p_index];
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+	if (da->change_dir(sd->full_path) == OK) {
+		data->file_counts[p_index] = _scan_new_dir(sd, da);
+	} else {
+		data->file_counts[p_index] = 0;
+		ERR_PRINT("Cannot go into subdir '" + sd->full_path + "'.");
+	}
+}
+
+int EditorFileSystem::_scan_new_dir_threaded(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (!pool || pool->get_thread_count() <= 1 || pool->get_thread_index() != -1) {
+		// Waiting for a group task from a worker could starve the pool.
+		return _scan_new_dir(p_dir, da);
+	}
+
+	// List directories breadth-first on this thread until there are enough subtrees to keep all
+	// workers busy, then walk each remaining subtree on its own worker.
+	const uint32_t min_subtrees = pool->get_thread_count() * 4;
+
+	LocalVector<ScannedDirectory *> pending;
+	pending.push_back(p_dir);
+	uint32_t from = 0;
+	int nb_files_total_scan = 0;
+
+	while (from < pending.size() && pending.size() - from < min_subtrees) {
+		ScannedDirectory *sd = pending[from++];
+		if (da->change_dir(sd->full_path) != OK) {
+			continue;
+		}
+		nb_files_total_scan += _list_new_dir(sd, da);
+		for (ScannedDirectory *sub_dir : sd->subdirs) {
+			pending.push_back(sub_dir);
+		}
+	}
+
+	const uint32_t subtree_count = pending.size() - from;
+	if (subtree_count == 0) {
+		return nb_files_total_scan;
+	}
+
+	LocalVector<int> file_counts;
+	file_counts.resize(subtree_count);
+
+	ScanDirThreadData data;
+	data.dirs = pending.ptr() + from;
+	data.file_counts = file_counts.ptr();
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&EditorFileSystem::_scan_new_dir_thread, &data, subtree_count, -1, true, "Scan project file system");
+	pool->wait_for_group_task_completion(group_task);
+
+	for (int count : file_counts) {
+		nb_files_total_scan += count;
+	}
 	return nb_files_total_scan;
 }
 
@@ -2842,7 +2966,30 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+	// Hashed once, for both the import cache key and the .md5 file.
+	const String source_md5 = FileAccess::get_md5(p_file);
+
+	String import_cache_path;
+	String import_cache_key;
+	if (importer->can_cache_import(params)) {
+		import_cache_path = EditorImportCache::get_cache_path();
+		if (!import_cache_path.is_empty()) {
+			import_cache_key = EditorImportCache::compute_key(importer, p_file, source_md5, opts, params);
+		}
+	}
+
+	Error err;
+	if (!import_cache_key.is_empty() && EditorImportCache::fetch(import_cache_path, import_cache_key, base_path, &import_variants, &meta)) {
+		print_verbose(vformat("EditorFileSystem: Restored '%s' from the import cache.", p_file));
+		import_cache_hits.increment();
+		err = OK;
+	} else {
+		if (!import_cache_key.is_empty()) {
+			import_cache_misses.increment();
+		}
+		err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+	}
 
 	// As import is complete, save the .import file.
 
@@ -2935,12 +3082,19 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		}
 	}
 
+	// Files generated elsewhere in the project can't be restored from the cache.
+	if (err == OK && !import_cache_key.is_empty() && gen_files.is_empty()) {
+		if (EditorImportCache::store(import_cache_path, import_cache_key, base_path, dest_paths, import_variants, meta)) {
+			import_cache_stores.increment();
+		}
+	}
+
 	// Store the md5's of the various files. These are stored separately so that the .import files can be version controlled.
 	{
 		Ref<FileAccess> md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
 		ERR_FAIL_COND_V_MSG(md5s.is_null(), ERR_FILE_CANT_OPEN, "Cannot open MD5 file '" + base_path + ".md5'.");
 
-		md5s->store_line("source_md5=\"" + FileAccess::get_md5(p_file) + "\"");
+		md5s->store_line("source_md5=\"" + source_md5 + "\"");
 		if (dest_paths.size()) {
 			md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
 		}
@@ -3016,6 +3170,14 @@ void EditorFileSystem::reimport_file_with_custom_parameters(const String &p_file
 	emit_signal(SNAME("resources_reimported"), reloads);
 }
 
+Dictionary EditorFileSystem::get_import_cache_statistics() const {
+	Dictionary stats;
+	stats["hits"] = import_cache_hits.get();
+	stats["misses"] = import_cache_misses.get();
+	stats["stores"] = import_cache_stores.get();
+	return stats;
+}
+
 Error EditorFileSystem::_copy_file(const String &p_from, const String &p_to) {
 	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 	if (FileAccess::exists(p_from + ".import")) {
@@ -3272,6 +3434,10 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ResourceUID::get_singleton()->update_cache(); // After reimporting, update the cache.
 	_save_filesystem_cache();
 
+	if (!EditorImportCache::get_cache_path().is_empty()) {
+		print_verbose(vformat("EditorFileSystem: Import cache totals: %d hits, %d misses, %d stored.", import_cache_hits.get(), import_cache_misses.get(), import_cache_stores.get()));
+	}
+
 	memdelete_notnull(ep);
 
 	_process_update_pending();
@@ -3563,6 +3729,7 @@ void EditorFileSystem::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_filesystem_path", "path"), &EditorFileSystem::get_filesystem_path);
 	ClassDB::bind_method(D_METHOD("get_file_type", "path"), &EditorFileSystem::get_file_type);
 	ClassDB::bind_method(D_METHOD("reimport_files", "files"), &EditorFileSystem::reimport_files);
+	ClassDB::bind_method(D_METHOD("get_import_cache_statistics"), &EditorFileSystem::get_import_cache_statistics);
 
 	ADD_SIGNAL(MethodInfo("filesystem_changed"));
 	ADD_SIGNAL(MethodInfo("script_classes_updated"));
@@ -147,6 +147,8 @@ public:
 class EditorFileSystem : public Node {
 	GDCLASS(EditorFileSystem, Node);
 
+	friend class TestEditorFileSystemAccessor;
+
 	_THREAD_SAFE_CLASS_
 
 	struct ItemAction {
@@ -258,7 +260,15 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
+	static int _list_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
 	static int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	static int _scan_new_dir_threaded(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+
+	struct ScanDirThreadData {
+		ScannedDirectory **dirs = nullptr;
+		int *file_counts = nullptr;
+	};
+	static void _scan_new_dir_thread(void *p_userdata, uint32_t p_index);
 	void _process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *p_processed_files);
 
 	Thread thread_sources;
@@ -277,12 +287,27 @@ class EditorFileSystem : public Node {
 	Error _reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options = HashMap<StringName, Variant>(), const String &p_custom_importer = String(), Variant *generator_parameters = nullptr, bool p_update_file_system = true);
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
-	bool _test_for_reimport(const String &p_path, const String &p_expected_import_md5);
+	struct ReimportTest {
+		String path;
+		String import_md5;
+		bool need_reimport = false;
+		// Importer whose settings check was deferred to the main thread.
+		Ref<ResourceImporter> importer;
+		Variant import_metadata;
+	};
+	static bool _test_for_reimport(const String &p_path, const String &p_expected_import_md5, ReimportTest *r_deferred = nullptr);
+	static void _test_for_reimport_thread(void *p_userdata, uint32_t p_index);
+	static void _test_for_reimport_parallel(LocalVector<ReimportTest> &p_tests);
+
 	bool _is_test_for_reimport_needed(const String &p_path, uint64_t p_last_modification_time, uint64_t p_modification_time, uint64_t p_last_import_modification_time, uint64_t p_import_modification_time, const Vector<String> &p_import_dest_paths);
 	Vector<String> _get_import_dest_paths(const String &p_path);
 
 	bool reimport_on_missing_imported_files;
 
+	SafeNumeric<uint64_t> import_cache_hits;
+	SafeNumeric<uint64_t> import_cache_misses;
+	SafeNumeric<uint64_t> import_cache_stores;
+
 	Vector<String> _get_dependencies(const String &p_path);
 
 	struct ImportFile {
@@ -407,6 +432,8 @@ public:
 
 	void reimport_file_with_custom_parameters(const String &p_file, const String &p_importer, const HashMap<StringName, Variant> &p_custom_params);
 
+	Dictionary get_import_cache_statistics() const;
+
 	bool is_group_file(const String &p_path) const;
 	void move_group_file(const String &p_path, const String &p_new_path);
 
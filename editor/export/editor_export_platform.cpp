@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/io/image_loader.h"
@@ -305,8 +306,18 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		ftmp = fae;
 	}
 
-	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
+	// Store file content, compressed if that makes it smaller.
+	Vector<uint8_t> blocks;
+	if (pd->compress && p_data.size() <= UINT32_MAX) {
+		blocks = FileAccessCompressed::compress_blocks(p_data.ptr(), p_data.size(), Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+	}
+	if (!blocks.is_empty() && blocks.size() + 4 < p_data.size()) {
+		sd.compressed = true;
+		ftmp->store_buffer((const uint8_t *)PACK_COMPRESSED_MAGIC, 4);
+		ftmp->store_buffer(blocks);
+	} else {
+		ftmp->store_buffer(p_data.ptr(), p_data.size());
+	}
 
 	if (fae.is_valid()) {
 		ftmp.unref();
@@ -1888,6 +1899,7 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress = GLOBAL_GET("editor/export/compress_pck_files");
 
 	Error err = export_project_files(p_preset, p_debug, p_save_func, p_remove_func, &pd, _pack_add_shared_object);
 
@@ -1944,8 +1956,16 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 
 	int64_t pck_start_pos = f->get_position();
 
+	uint32_t pack_version = PACK_FORMAT_VERSION_UNCOMPRESSED;
+	for (int i = 0; i < pd.file_ofs.size(); i++) {
+		if (pd.file_ofs[i].compressed) {
+			pack_version = PACK_FORMAT_VERSION;
+			break;
+		}
+	}
+
 	f->store_32(PACK_HEADER_MAGIC);
-	f->store_32(PACK_FORMAT_VERSION);
+	f->store_32(pack_version);
 	f->store_32(VERSION_MAJOR);
 	f->store_32(VERSION_MINOR);
 	f->store_32(VERSION_PATCH);
@@ -2056,6 +2076,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		if (pd.file_ofs[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
@@ -82,6 +82,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
@@ -96,6 +97,7 @@ private:
 		Vector<SavedData> file_ofs;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+		bool compress = false;
 	};
 
 	struct ZipData {
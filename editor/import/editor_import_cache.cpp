@@ -0,0 +1,210 @@
+/**************************************************************************/
+/*  editor_import_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "editor_import_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+#include "core/version.h"
+
+String EditorImportCache::_get_entry_dir(const String &p_cache_path, const String &p_key) {
+	// Fan out on the first byte of the key, so no single directory grows too large.
+	return p_cache_path.path_join(p_key.substr(0, 2)).path_join(p_key);
+}
+
+String EditorImportCache::get_cache_path() {
+	String path = GLOBAL_GET("editor/import/shared_cache_path");
+	if (path.is_empty()) {
+		return String();
+	}
+	return ProjectSettings::get_singleton()->globalize_path(path).simplify_path();
+}
+
+String EditorImportCache::compute_key(const Ref<ResourceImporter> &p_importer, const String &p_source_file, const String &p_source_md5, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) {
+	ERR_FAIL_COND_V(p_importer.is_null(), String());
+	if (p_source_md5.is_empty()) {
+		return String();
+	}
+
+	CryptoCore::SHA256Context ctx;
+	ctx.start();
+
+	// Every field is NUL terminated, so adjacent fields can't run into each other.
+	const auto add = [&ctx](const String &p_value) {
+		CharString cs = p_value.utf8();
+		ctx.update((const uint8_t *)cs.get_data(), cs.length() + 1);
+	};
+
+	add(VERSION_FULL_CONFIG);
+	add(p_importer->get_importer_name());
+	add(itos(p_importer->get_format_version()));
+	add(p_importer->get_import_settings_string());
+	// Imported resources may reference their own path, so entries are only shared
+	// between copies of the same file at the same location.
+	add(p_source_file);
+	add(p_source_md5);
+
+	// Options are hashed in the importer's order, like they are written to the .import file.
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		const String &name = E.option.name;
+		String text;
+		const Variant *value = p_params.getptr(name);
+		if (value) {
+			VariantWriter::write_to_string(*value, text);
+			if (value->get_type() == Variant::STRING) {
+				// Options pointing at other project files (e.g. the normal map used to
+				// generate roughness mipmaps) make the output depend on those files too.
+				const String path = *value;
+				if (path.begins_with("res://") && FileAccess::exists(path)) {
+					text += ":" + FileAccess::get_md5(path);
+				}
+			}
+		}
+		add(name);
+		add(text);
+	}
+
+	unsigned char hash[32];
+	ctx.finish(hash);
+	return String::hex_encode_buffer(hash, 32);
+}
+
+bool EditorImportCache::fetch(const String &p_cache_path, const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata) {
+	const String entry = _get_entry_dir(p_cache_path, p_key);
+
+	// The manifest is the last thing written, an entry without one is incomplete.
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(entry.path_join("manifest.cfg")) != OK || !manifest->has_section_key("entry", "files")) {
+		return false;
+	}
+
+	const PackedStringArray files = manifest->get_value("entry", "files");
+	if (files.is_empty()) {
+		return false;
+	}
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	const String base = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	for (const String &suffix : files) {
+		if (da->copy(entry.path_join("data" + suffix), base + suffix) != OK) {
+			return false;
+		}
+	}
+
+	if (manifest->has_section_key("entry", "variants")) {
+		const PackedStringArray variants = manifest->get_value("entry", "variants");
+		for (const String &variant : variants) {
+			r_variants->push_back(variant);
+		}
+	}
+	if (manifest->has_section_key("entry", "metadata")) {
+		*r_metadata = manifest->get_value("entry", "metadata");
+	}
+
+	return true;
+}
+
+bool EditorImportCache::store(const String &p_cache_path, const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_variants, const Variant &p_metadata) {
+	if (p_dest_paths.is_empty()) {
+		return false;
+	}
+
+	const String entry = _get_entry_dir(p_cache_path, p_key);
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->dir_exists(entry)) {
+		// Stored by another project or machine in the meantime.
+		return false;
+	}
+
+	// Build the entry in a private directory and move it into place at the end, so
+	// concurrent editors sharing the cache never see it half written.
+	const String tmp = p_cache_path.path_join("tmp").path_join(vformat("%s-%d-%d", p_key, OS::get_singleton()->get_process_id(), (uint64_t)Thread::get_caller_id()));
+	Error err = da->make_dir_recursive(tmp);
+	ERR_FAIL_COND_V_MSG(err != OK, false, vformat("Cannot create import cache directory '%s'.", tmp));
+
+	const String base_file = p_base_path.get_file();
+	PackedStringArray files;
+	for (const String &dest : p_dest_paths) {
+		const String file = dest.get_file();
+		if (dest.get_base_dir() != p_base_path.get_base_dir() || !file.begins_with(base_file + ".")) {
+			// Not one of the importer's own outputs, can't be restored from the cache.
+			err = ERR_INVALID_PARAMETER;
+			break;
+		}
+		const String suffix = file.substr(base_file.length());
+		err = da->copy(ProjectSettings::get_singleton()->globalize_path(dest), tmp.path_join("data" + suffix));
+		if (err != OK) {
+			break;
+		}
+		files.push_back(suffix);
+	}
+
+	if (err == OK) {
+		Ref<ConfigFile> manifest;
+		manifest.instantiate();
+		manifest->set_value("entry", "files", files);
+		if (!p_variants.is_empty()) {
+			PackedStringArray variants;
+			for (const String &variant : p_variants) {
+				variants.push_back(variant);
+			}
+			manifest->set_value("entry", "variants", variants);
+		}
+		if (p_metadata.get_type() != Variant::NIL) {
+			manifest->set_value("entry", "metadata", p_metadata);
+		}
+		err = manifest->save(tmp.path_join("manifest.cfg"));
+	}
+
+	if (err == OK) {
+		da->make_dir_recursive(entry.get_base_dir());
+		err = da->rename(tmp, entry);
+	}
+
+	if (err != OK) {
+		Ref<DirAccess> tmp_da = DirAccess::open(tmp);
+		if (tmp_da.is_valid()) {
+			tmp_da->erase_contents_recursive();
+		}
+		da->remove(tmp);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,50 @@
+/**************************************************************************/
+/*  editor_import_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/io/resource_importer.h"
+
+// Content-addressed store for import results, shared between projects, branches
+// and machines through a plain directory (`editor/import/shared_cache_path`).
+// Entries are keyed on everything that determines an importer's output, so a hit
+// can be copied into `.godot/imported` instead of running the importer again.
+class EditorImportCache {
+	static String _get_entry_dir(const String &p_cache_path, const String &p_key);
+
+public:
+	static String get_cache_path();
+
+	// p_source_md5 is the MD5 of the source file, which reimporting computes anyway for the `.md5` file.
+	static String compute_key(const Ref<ResourceImporter> &p_importer, const String &p_source_file, const String &p_source_md5, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params);
+	static bool fetch(const String &p_cache_path, const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata);
+	static bool store(const String &p_cache_path, const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_variants, const Variant &p_metadata);
+};
@@ -117,6 +117,7 @@ public:
 	virtual String get_import_settings_string() const override;
 
 	virtual bool can_import_threaded() const override { return true; }
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const override { return true; }
 
 	void set_mode(Mode p_mode) { mode = p_mode; }
 
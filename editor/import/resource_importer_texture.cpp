@@ -535,8 +535,8 @@ Error ResourceImporterTexture::import(ResourceUID::ID p_source_id, const String
 		}
 	}
 
-	// Support for texture streaming is not implemented yet.
-	const bool stream = false;
+	// Any texture with mipmaps can be streamed, whether it actually is depends on the project settings at run-time.
+	const bool stream = mipmaps;
 
 	// SVG-specific options.
 	float scale = p_options.has("svg/scale") ? float(p_options["svg/scale"]) : 1.0f;
@@ -775,6 +775,13 @@ const char *ResourceImporterTexture::compression_formats[] = {
 	nullptr
 };
 
+bool ResourceImporterTexture::can_cache_import(const HashMap<StringName, Variant> &p_options) const {
+	// Editor icon variants depend on the editor scale and theme, not just on the options.
+	const bool use_editor_scale = p_options.has("editor/scale_with_editor_scale") && p_options["editor/scale_with_editor_scale"];
+	const bool convert_editor_colors = p_options.has("editor/convert_colors_with_editor_theme") && p_options["editor/convert_colors_with_editor_theme"];
+	return !use_editor_scale && !convert_editor_colors;
+}
+
 String ResourceImporterTexture::get_import_settings_string() const {
 	String s;
 
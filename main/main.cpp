@@ -210,6 +210,8 @@ static int converter_max_line_length = 100000;
 HashMap<Main::CLIScope, Vector<String>> forwardable_cli_arguments;
 #endif
 static bool single_threaded_scene = false;
+static bool dedicated_server = false;
+static int dedicated_server_spin_usec = 0;
 
 // Display
 
@@ -569,6 +571,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--text-driver <driver>", "Text driver (used for font rendering, bidirectional support and shaping).\n");
 	print_help_option("--tablet-driver <driver>", "Pen tablet input driver.\n");
 	print_help_option("--headless", "Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script.\n");
+	print_help_option("--dedicated-server", "Enable headless mode and run exactly one physics tick and one process frame per physics tick, without rendering.\n");
+	print_help_option("", "--print-fps prints a histogram of the tick durations when enabled.\n");
 	print_help_option("--log-file <file>", "Write output/error log to the specified path instead of the default location defined by the project.\n");
 	print_help_option("", "<file> path should be absolute or relative to the project directory.\n");
 	print_help_option("--write-movie <file>", "Write a video to the specified path (usually with .avi or .png extension).\n");
@@ -1424,6 +1428,11 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 		} else if (arg == "--single-threaded-scene") {
 			single_threaded_scene = true;
+		} else if (arg == "--dedicated-server") { // Headless mode, driven only by physics ticks.
+
+			audio_driver = NULL_AUDIO_DRIVER;
+			display_driver = NULL_DISPLAY_DRIVER;
+			dedicated_server = true;
 		} else if (arg == "--build-solutions") { // Build the scripting solution such C#
 
 			auto_build_solutions = true;
@@ -1944,6 +1953,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	Engine::get_singleton()->set_max_physics_steps_per_frame(GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "physics/common/max_physics_steps_per_frame", PROPERTY_HINT_RANGE, "1,100,1"), 8));
 	Engine::get_singleton()->set_physics_jitter_fix(GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/common/physics_jitter_fix", PROPERTY_HINT_RANGE, "0,2,0.001,or_greater"), 0.5));
 	Engine::get_singleton()->set_max_fps(GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/max_fps", PROPERTY_HINT_RANGE, "0,1000,1"), 0));
+	dedicated_server_spin_usec = GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/dedicated_server_spin_usec", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 0);
 	if (max_fps >= 0) {
 		Engine::get_singleton()->set_max_fps(max_fps);
 	}
@@ -3497,6 +3507,7 @@ Error Main::setup2(bool p_show_boot_logo) {
 
 	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
 	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
+	ClassDB::freeze();
 	MAIN_PRINT("Main: Done");
 
 	OS::get_singleton()->benchmark_end_measure("Startup", "Main::Setup2");
@@ -3998,6 +4009,10 @@ int Main::start() {
 			sml->set_disable_node_threading(true);
 		}
 
+		if (dedicated_server) {
+			sml->set_disable_rendering_updates(true);
+		}
+
 		bool embed_subwindows = GLOBAL_GET("display/window/subwindows/embed_subwindows");
 
 		if (single_window || (!project_manager && !editor && embed_subwindows) || !DisplayServer::get_singleton()->has_feature(DisplayServer::Feature::FEATURE_SUBWINDOWS)) {
@@ -4387,10 +4402,163 @@ static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
 
+// For --dedicated-server tick duration reports, bucket N counts the ticks
+// shorter than 250 << N usec, the last one counts all the others.
+static const int SERVER_TICK_HISTOGRAM_SIZE = 8;
+static uint32_t server_tick_histogram[SERVER_TICK_HISTOGRAM_SIZE] = {};
+static uint64_t server_tick_total = 0;
+static uint64_t server_tick_max = 0;
+static uint64_t server_next_tick = 0;
+
+// Runs exactly one physics tick and one process frame per call, without
+// MainTimerSync or rendering, then waits for the next tick.
+bool Main::server_iteration() {
+	iterating++;
+
+	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+	Engine::get_singleton()->_frame_ticks = ticks;
+
+	const int physics_ticks_per_second = Engine::get_singleton()->get_physics_ticks_per_second();
+	const double physics_step = 1.0 / physics_ticks_per_second;
+	const uint64_t tick_usec = 1000000 / physics_ticks_per_second;
+	const double scaled_step = physics_step * Engine::get_singleton()->get_time_scale();
+
+	Engine::get_singleton()->_process_step = physics_step;
+	Engine::get_singleton()->_physics_interpolation_fraction = 0;
+
+	frame += ticks - last_ticks;
+	last_ticks = ticks;
+
+	bool exit = false;
+	MainLoop *main_loop = OS::get_singleton()->get_main_loop();
+
+	NavigationServer2D::get_singleton()->sync();
+	NavigationServer3D::get_singleton()->sync();
+
+	Engine::get_singleton()->_in_physics = true;
+	Engine::get_singleton()->_physics_frames++;
+
+	main_loop->iteration_prepare();
+
+#ifndef _3D_DISABLED
+	PhysicsServer3D::get_singleton()->sync();
+	PhysicsServer3D::get_singleton()->flush_queries();
+#endif // _3D_DISABLED
+
+	PhysicsServer2D::get_singleton()->sync();
+	PhysicsServer2D::get_singleton()->flush_queries();
+
+	if (main_loop->physics_process(scaled_step)) {
+#ifndef _3D_DISABLED
+		PhysicsServer3D::get_singleton()->end_sync();
+#endif // _3D_DISABLED
+		PhysicsServer2D::get_singleton()->end_sync();
+		exit = true;
+	} else {
+		NavigationServer3D::get_singleton()->process(scaled_step);
+
+		message_queue->flush();
+
+#ifndef _3D_DISABLED
+		PhysicsServer3D::get_singleton()->end_sync();
+		PhysicsServer3D::get_singleton()->step(scaled_step);
+#endif // _3D_DISABLED
+
+		PhysicsServer2D::get_singleton()->end_sync();
+		PhysicsServer2D::get_singleton()->step(scaled_step);
+
+		message_queue->flush();
+
+		main_loop->iteration_end();
+	}
+
+	Engine::get_singleton()->_in_physics = false;
+
+	// Networking, timers and deferred calls rely on process frames, run one per tick.
+	if (!exit && main_loop->process(scaled_step)) {
+		exit = true;
+	}
+	message_queue->flush();
+
+	// Nothing is drawn, but calls made from other threads still wait for the main thread to flush them.
+	RenderingServer::get_singleton()->sync();
+
+	const uint64_t tick_time = OS::get_singleton()->get_ticks_usec() - ticks;
+
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		ScriptServer::get_language(i)->frame();
+	}
+
+	// Frees finished playbacks and runs update callbacks, even though nothing is heard.
+	AudioServer::get_singleton()->update();
+
+	if (EngineDebugger::is_active()) {
+		EngineDebugger::get_singleton()->iteration(tick_time, tick_time, tick_time, physics_step);
+	}
+
+	int bucket = 0;
+	while (bucket < SERVER_TICK_HISTOGRAM_SIZE - 1 && tick_time >= (250u << bucket)) {
+		bucket++;
+	}
+	server_tick_histogram[bucket]++;
+	server_tick_total += tick_time;
+	server_tick_max = MAX(tick_time, server_tick_max);
+
+	frames++;
+	Engine::get_singleton()->_process_frames++;
+
+	if (frame > 1000000) {
+		if (print_fps || GLOBAL_GET("debug/settings/stdout/print_fps")) {
+			String histogram;
+			for (int i = 0; i < SERVER_TICK_HISTOGRAM_SIZE; i++) {
+				const String bound = rtos((250 << MIN(i, SERVER_TICK_HISTOGRAM_SIZE - 2)) / 1000.0);
+				histogram += vformat("%s%s%s ms: %d", i == 0 ? "" : ", ", i < SERVER_TICK_HISTOGRAM_SIZE - 1 ? "<" : ">=", bound, server_tick_histogram[i]);
+			}
+			print_line(vformat("Server ticks: %d (avg %s ms, max %s ms) [%s]", frames, rtos(server_tick_total / 1000.0 / frames).pad_decimals(2), rtos(server_tick_max / 1000.0).pad_decimals(2), histogram));
+		}
+
+		Engine::get_singleton()->_fps = frames;
+		performance->set_process_time(USEC_TO_SEC(server_tick_max));
+		performance->set_physics_process_time(USEC_TO_SEC(server_tick_max));
+		memset(server_tick_histogram, 0, sizeof(server_tick_histogram));
+		server_tick_total = 0;
+		server_tick_max = 0;
+
+		frame %= 1000000;
+		frames = 0;
+	}
+
+	iterating--;
+
+	if ((quit_after > 0) && (Engine::get_singleton()->_process_frames >= quit_after)) {
+		exit = true;
+	}
+
+	if (server_next_tick == 0 || ticks > server_next_tick + tick_usec * Engine::get_singleton()->get_max_physics_steps_per_frame()) {
+		// Too far behind to catch up, drop the late ticks.
+		server_next_tick = ticks;
+	}
+	server_next_tick += tick_usec;
+
+	// Sleeping can oversleep by a scheduler time slice, so optionally spin for the end of the wait.
+	const uint64_t now = OS::get_singleton()->get_ticks_usec();
+	if (server_next_tick > now + dedicated_server_spin_usec) {
+		OS::get_singleton()->delay_usec(server_next_tick - now - dedicated_server_spin_usec);
+	}
+	while (OS::get_singleton()->get_ticks_usec() < server_next_tick) {
+	}
+
+	return exit;
+}
+
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
 // to be set explicitly here (defaults to EXIT_SUCCESS).
 bool Main::iteration() {
+	if (dedicated_server) {
+		return server_iteration();
+	}
+
 	iterating++;
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
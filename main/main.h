@@ -58,6 +58,8 @@ class Main {
 	static bool force_redraw_requested;
 	static int iterating;
 
+	static bool server_iteration();
+
 public:
 	static bool is_cmdline_tool();
 #ifdef TOOLS_ENABLED
@@ -30,6 +30,8 @@
 
 #include "enet_multiplayer_peer.h"
 
+#include "core/os/os.h"
+
 void ENetMultiplayerPeer::set_target_peer(int p_peer) {
 	target_peer = p_peer;
 }
@@ -157,13 +159,90 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 			hosts.erase(P);
 		}
 		ERR_CONTINUE(active_mode == MODE_CLIENT && P != TARGET_PEER_SERVER);
-		emit_signal(SNAME("peer_disconnected"), P);
+		_queue_peer_event(P, false);
+	}
+}
+
+void ENetMultiplayerPeer::_parse_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		connection_status = CONNECTION_CONNECTED;
+		_queue_peer_event(1, true);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		if (connection_status == CONNECTION_CONNECTED) {
+			// Client just disconnected from server.
+			_queue_peer_event(1, false);
+		}
+		close();
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		_store_packet(1, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error.
+	}
+}
+
+void ENetMultiplayerPeer::_parse_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		if (is_refusing_new_connections()) {
+			p_event.peer->reset();
+			return;
+		}
+		// Client joined with invalid ID, probably trying to exploit us.
+		if (p_event.data < 2 || peers.has((int)p_event.data)) {
+			p_event.peer->reset();
+			return;
+		}
+		int id = p_event.data;
+		p_event.peer->set_meta(SNAME("_net_id"), id);
+		peers[id] = p_event.peer;
+		_queue_peer_event(id, true);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		int id = p_event.peer->get_meta(SNAME("_net_id"));
+		if (!peers.has(id)) {
+			// Never fully connected.
+			return;
+		}
+		_queue_peer_event(id, false);
+		peers.erase(id);
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		int32_t source = p_event.peer->get_meta(SNAME("_net_id"));
+		_store_packet(source, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error
 	}
 }
 
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
+	{
+		MutexLock lock(network_mutex);
+		_poll_events();
+		// Started on the first poll, so the host can still be set up (e.g. compression, DTLS) after creating it.
+		if (network_thread_enabled && _is_active() && active_mode != MODE_MESH && !network_thread.is_started()) {
+			_start_network_thread();
+		}
+	}
+	// Signal handlers may take a while, don't stall the network thread meanwhile.
+	_emit_peer_events();
+}
+
+void ENetMultiplayerPeer::_queue_peer_event(int p_id, bool p_connected) {
+	PeerEvent event;
+	event.id = p_id;
+	event.connected = p_connected;
+	peer_events.push_back(event);
+}
+
+void ENetMultiplayerPeer::_emit_peer_events() {
+	// Handlers might poll again, so emit from a copy.
+	LocalVector<PeerEvent> events = std::move(peer_events);
+	peer_events.clear();
+	for (const PeerEvent &event : events) {
+		emit_signal(event.connected ? SNAME("peer_connected") : SNAME("peer_disconnected"), event.id);
+	}
+}
+
+void ENetMultiplayerPeer::_poll_events() {
 	_pop_current_packet();
 
 	_disconnect_inactive_peers();
@@ -174,57 +253,34 @@ void ENetMultiplayerPeer::poll() {
 				close();
 				return;
 			}
+			if (network_thread.is_started()) {
+				// Events were already received by the network thread, the list is cleared on close.
+				while (!thread_events.is_empty()) {
+					ThreadEvent te = thread_events.front()->get();
+					thread_events.pop_front();
+					_parse_client_event(te.type, te.event);
+				}
+				break;
+			}
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					connection_status = CONNECTION_CONNECTED;
-					emit_signal(SNAME("peer_connected"), 1);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					if (connection_status == CONNECTION_CONNECTED) {
-						// Client just disconnected from server.
-						emit_signal(SNAME("peer_disconnected"), 1);
-					}
-					close();
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error.
-				}
+				_parse_client_event(ret, event);
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_SERVER: {
+			if (network_thread.is_started()) {
+				while (!thread_events.is_empty()) {
+					ThreadEvent te = thread_events.front()->get();
+					thread_events.pop_front();
+					_parse_server_event(te.type, te.event);
+				}
+				break;
+			}
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					if (is_refusing_new_connections()) {
-						event.peer->reset();
-						continue;
-					}
-					// Client joined with invalid ID, probably trying to exploit us.
-					if (event.data < 2 || peers.has((int)event.data)) {
-						event.peer->reset();
-						continue;
-					}
-					int id = event.data;
-					event.peer->set_meta(SNAME("_net_id"), id);
-					peers[id] = event.peer;
-					emit_signal(SNAME("peer_connected"), id);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					int id = event.peer->get_meta(SNAME("_net_id"));
-					if (!peers.has(id)) {
-						// Never fully connected.
-						continue;
-					}
-					emit_signal(SNAME("peer_disconnected"), id);
-					peers.erase(id);
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					int32_t source = event.peer->get_meta(SNAME("_net_id"));
-					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
-				}
+				_parse_server_event(ret, event);
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_MESH: {
@@ -247,7 +303,7 @@ void ENetMultiplayerPeer::poll() {
 			}
 			for (const int &P : to_drop) {
 				if (peers.has(P)) {
-					emit_signal(SNAME("peer_disconnected"), P);
+					_queue_peer_event(P, false);
 					peers.erase(P);
 				}
 				hosts.erase(P);
@@ -268,6 +324,7 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
+	MutexLock lock(network_mutex);
 	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
 	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
 		hosts[0]->flush();
@@ -292,6 +349,10 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	MutexLock lock(network_mutex);
+	_stop_network_thread();
+	_clear_thread_events();
+
 	_pop_current_packet();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
@@ -367,6 +428,11 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	MutexLock lock(network_mutex);
+	// The network thread flushes the queued packets on its next iteration, unless it is idling.
+	const bool flush = !network_thread.is_started() || network_thread_idle.is_set();
+	network_thread_sent.set();
+
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -385,12 +451,16 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 			peers[target_peer]->send(channel, packet);
 		}
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush) {
+			hosts[0]->flush();
+		}
 
 	} else if (active_mode == MODE_CLIENT) {
 		peers[1]->send(channel, packet); // Send to server for broadcast.
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush) {
+			hosts[0]->flush();
+		}
 
 	} else {
 		if (target_peer <= 0) {
@@ -440,6 +510,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(network_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -451,6 +522,7 @@ void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 Ref<ENetConnection> ENetMultiplayerPeer::get_host() const {
 	ERR_FAIL_COND_V(!_is_active(), nullptr);
 	ERR_FAIL_COND_V(active_mode == MODE_MESH, nullptr);
+	ERR_FAIL_COND_V_MSG(network_thread.is_started(), nullptr, "The host can't be accessed while the network thread is running.");
 	return hosts[0];
 }
 
@@ -458,9 +530,94 @@ Ref<ENetPacketPeer> ENetMultiplayerPeer::get_peer(int p_id) const {
 	ERR_FAIL_COND_V(!_is_active(), nullptr);
 	ERR_FAIL_COND_V(!peers.has(p_id), nullptr);
 	ERR_FAIL_COND_V(active_mode == MODE_CLIENT && p_id != 1, nullptr);
+	ERR_FAIL_COND_V_MSG(network_thread.is_started(), nullptr, "Peers can't be accessed while the network thread is running.");
 	return peers[p_id];
 }
 
+void ENetMultiplayerPeer::_network_thread_func(void *p_userdata) {
+	ENetMultiplayerPeer *peer = static_cast<ENetMultiplayerPeer *>(p_userdata);
+	uint64_t interval = NETWORK_THREAD_MIN_INTERVAL_USEC;
+	while (!peer->network_thread_exit.is_set()) {
+		bool active = peer->network_thread_sent.is_set();
+		peer->network_thread_sent.clear();
+		// Never block on the lock, the main thread might be waiting for us to exit while holding it.
+		if (peer->network_mutex.try_lock()) {
+			active = peer->_service_host() || active;
+			peer->network_mutex.unlock();
+		}
+		// Back off while there is no traffic, put_packet() flushes by itself meanwhile.
+		interval = active ? NETWORK_THREAD_MIN_INTERVAL_USEC : MIN(interval * 2, (uint64_t)NETWORK_THREAD_MAX_INTERVAL_USEC);
+		peer->network_thread_idle.set_to(interval > NETWORK_THREAD_MIN_INTERVAL_USEC);
+		OS::get_singleton()->delay_usec(interval);
+	}
+}
+
+bool ENetMultiplayerPeer::_service_host() {
+	if (!hosts.has(0)) {
+		return false;
+	}
+	Ref<ENetConnection> host = hosts[0];
+	if (thread_events.size() >= NETWORK_THREAD_MAX_EVENTS) {
+		// The main thread is not keeping up, leave the events in ENet's queues until it polls.
+		host->flush();
+		return true;
+	}
+	bool received = false;
+	ENetConnection::Event event;
+	ENetConnection::EventType ret = host->service(0, event);
+	do {
+		if (ret == ENetConnection::EVENT_NONE) {
+			continue;
+		}
+		ThreadEvent te;
+		te.type = ret;
+		te.event = event;
+		thread_events.push_back(te);
+		received = true;
+		if (ret == ENetConnection::EVENT_ERROR || thread_events.size() >= NETWORK_THREAD_MAX_EVENTS) {
+			break; // Let the main thread handle it.
+		}
+	} while (host->check_events(ret, event) > 0);
+	host->flush();
+	return received;
+}
+
+void ENetMultiplayerPeer::_start_network_thread() {
+	if (!network_thread_enabled) {
+		return;
+	}
+	ERR_FAIL_COND(network_thread.is_started());
+	network_thread_exit.clear();
+	network_thread_idle.clear();
+	network_thread.start(_network_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_network_thread() {
+	if (!network_thread.is_started()) {
+		return;
+	}
+	network_thread_exit.set();
+	network_thread.wait_to_finish();
+}
+
+void ENetMultiplayerPeer::_clear_thread_events() {
+	for (ThreadEvent &E : thread_events) {
+		if (E.event.packet) {
+			_destroy_unused(E.event.packet);
+		}
+	}
+	thread_events.clear();
+}
+
+void ENetMultiplayerPeer::set_network_thread_enabled(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The network thread can only be enabled or disabled before creating a server or client.");
+	network_thread_enabled = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_network_thread_enabled() const {
+	return network_thread_enabled;
+}
+
 void ENetMultiplayerPeer::_destroy_unused(ENetPacket *p_packet) {
 	if (p_packet->referenceCount == 0) {
 		enet_packet_destroy(p_packet);
@@ -473,11 +630,14 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_mesh", "unique_id"), &ENetMultiplayerPeer::create_mesh);
 	ClassDB::bind_method(D_METHOD("add_mesh_peer", "peer_id", "host"), &ENetMultiplayerPeer::add_mesh_peer);
 	ClassDB::bind_method(D_METHOD("set_bind_ip", "ip"), &ENetMultiplayerPeer::set_bind_ip);
+	ClassDB::bind_method(D_METHOD("set_network_thread_enabled", "enabled"), &ENetMultiplayerPeer::set_network_thread_enabled);
+	ClassDB::bind_method(D_METHOD("is_network_thread_enabled"), &ENetMultiplayerPeer::is_network_thread_enabled);
 
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "network_thread"), "set_network_thread_enabled", "is_network_thread_enabled");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -33,6 +33,9 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -52,6 +55,12 @@ private:
 		SYSCH_MAX = 2
 	};
 
+	enum {
+		NETWORK_THREAD_MIN_INTERVAL_USEC = 1000,
+		NETWORK_THREAD_MAX_INTERVAL_USEC = 8000, // When there is no traffic.
+		NETWORK_THREAD_MAX_EVENTS = 4096, // Further events wait in ENet's queues.
+	};
+
 	enum Mode {
 		MODE_NONE,
 		MODE_SERVER,
@@ -81,6 +90,40 @@ private:
 
 	Packet current_packet;
 
+	struct ThreadEvent {
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	// When enabled, the host is serviced and flushed by a separate thread,
+	// which queues the events for the main thread to parse during poll.
+	bool network_thread_enabled = false;
+	Thread network_thread;
+	SafeFlag network_thread_exit;
+	SafeFlag network_thread_idle;
+	SafeFlag network_thread_sent;
+	Mutex network_mutex;
+	List<ThreadEvent> thread_events;
+
+	static void _network_thread_func(void *p_userdata);
+	void _start_network_thread();
+	void _stop_network_thread();
+	bool _service_host();
+	void _clear_thread_events();
+
+	// Peer (dis)connections found while holding the lock, emitted once poll() releases it.
+	struct PeerEvent {
+		int id = 0;
+		bool connected = false;
+	};
+	LocalVector<PeerEvent> peer_events;
+
+	void _queue_peer_event(int p_id, bool p_connected);
+	void _poll_events();
+	void _emit_peer_events();
+
+	void _parse_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
+	void _parse_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
@@ -125,6 +168,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_network_thread_enabled(bool p_enabled);
+	bool is_network_thread_enabled() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
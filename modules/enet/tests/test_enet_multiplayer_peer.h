@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  test_enet_multiplayer_peer.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../enet_multiplayer_peer.h"
+
+#include "core/os/os.h"
+#include "tests/test_macros.h"
+
+namespace TestENetMultiplayerPeer {
+
+class PeerEventRecorder : public Object {
+public:
+	LocalVector<int> connected;
+	LocalVector<int> disconnected;
+
+	void _on_peer_connected(int p_id) { connected.push_back(p_id); }
+	void _on_peer_disconnected(int p_id) { disconnected.push_back(p_id); }
+
+	void watch(Ref<ENetMultiplayerPeer> p_peer) {
+		p_peer->connect(SNAME("peer_connected"), callable_mp(this, &PeerEventRecorder::_on_peer_connected));
+		p_peer->connect(SNAME("peer_disconnected"), callable_mp(this, &PeerEventRecorder::_on_peer_disconnected));
+	}
+};
+
+template <typename F>
+static bool poll_until(const Ref<ENetMultiplayerPeer> &p_server, const Ref<ENetMultiplayerPeer> &p_client, F p_done) {
+	const uint64_t deadline = OS::get_singleton()->get_ticks_msec() + 5000;
+	while (OS::get_singleton()->get_ticks_msec() < deadline) {
+		p_server->poll();
+		if (p_client->get_connection_status() != MultiplayerPeer::CONNECTION_DISCONNECTED) {
+			p_client->poll();
+		}
+		if (p_done()) {
+			return true;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return false;
+}
+
+TEST_CASE("[ENet][MultiplayerPeer] Loopback with network thread") {
+	Ref<ENetMultiplayerPeer> server;
+	server.instantiate();
+	server->set_bind_ip(IPAddress("127.0.0.1"));
+	server->set_network_thread_enabled(true);
+	int port = 0;
+	for (int p = 27960; p < 28060; p++) {
+		// Skip ports in use by other processes.
+		if (server->create_server(p) == OK) {
+			port = p;
+			break;
+		}
+	}
+	REQUIRE_MESSAGE(port != 0, "No free local port for the ENet server.");
+
+	Ref<ENetMultiplayerPeer> client;
+	client.instantiate();
+	client->set_network_thread_enabled(true);
+	REQUIRE(client->create_client("127.0.0.1", port) == OK);
+
+	// The thread only starts polling, the hosts can still be configured until then.
+	REQUIRE(server->get_host().is_valid());
+	REQUIRE(client->get_host().is_valid());
+	server->get_host()->compress(ENetConnection::COMPRESS_RANGE_CODER);
+	client->get_host()->compress(ENetConnection::COMPRESS_RANGE_CODER);
+
+	PeerEventRecorder server_events;
+	PeerEventRecorder client_events;
+	server_events.watch(server);
+	client_events.watch(client);
+
+	REQUIRE(poll_until(server, client, [&]() { return server_events.connected.size() == 1 && client_events.connected.size() == 1; }));
+	const int client_id = client->get_unique_id();
+	CHECK(server_events.connected[0] == client_id);
+	CHECK(client_events.connected[0] == 1);
+	CHECK(client->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED);
+
+	ERR_PRINT_OFF;
+	// The thread owns the ENet objects while running.
+	CHECK(server->get_host().is_null());
+	CHECK(server->get_peer(client_id).is_null());
+	ERR_PRINT_ON;
+
+	const uint8_t request[] = { 1, 2, 3, 4 };
+	client->set_target_peer(1);
+	CHECK(client->put_packet(request, sizeof(request)) == OK);
+	REQUIRE(poll_until(server, client, [&]() { return server->get_available_packet_count() > 0; }));
+	CHECK(server->get_packet_peer() == client_id);
+	const uint8_t *buffer = nullptr;
+	int size = 0;
+	REQUIRE(server->get_packet(&buffer, size) == OK);
+	REQUIRE(size == (int)sizeof(request));
+	CHECK(memcmp(buffer, request, size) == 0);
+
+	// Sending after a quiet period must not wait for the idle thread.
+	OS::get_singleton()->delay_usec(50000);
+	const uint8_t reply[] = { 5, 6 };
+	server->set_target_peer(client_id);
+	CHECK(server->put_packet(reply, sizeof(reply)) == OK);
+	REQUIRE(poll_until(server, client, [&]() { return client->get_available_packet_count() > 0; }));
+	REQUIRE(client->get_packet(&buffer, size) == OK);
+	REQUIRE(size == (int)sizeof(reply));
+	CHECK(memcmp(buffer, reply, size) == 0);
+
+	client->disconnect_peer(1);
+	REQUIRE(poll_until(server, client, [&]() { return server_events.disconnected.size() == 1 && client_events.disconnected.size() == 1; }));
+	CHECK(server_events.disconnected[0] == client_id);
+	CHECK(client_events.disconnected[0] == 1);
+	CHECK(client->get_connection_status() == MultiplayerPeer::CONNECTION_DISCONNECTED);
+
+	server->close();
+}
+
+} // namespace TestENetMultiplayerPeer
@@ -758,10 +758,10 @@ namespace Godot.NativeInterop
         {
             private uint _safeRefCount;
 
-            public VariantVector _arrayVector;
-
             private unsafe godot_variant* _readOnly;
 
+            public InlineVariantVector _arrayVector;
+
             // There are more fields here, but we don't care as we never store this in C#
 
             public readonly int Size
@@ -790,10 +790,34 @@ namespace Godot.NativeInterop
             }
         }
 
+        // InlineVector<Variant, 4>: the elements are stored right after these fields until they spill to the heap Vector.
+        [StructLayout(LayoutKind.Sequential)]
+        private struct InlineVariantVector
+        {
+            private IntPtr _writeProxy;
+            private VariantVector _heap;
+            private long _inlineSize;
+            private byte _spilled;
+
+            public readonly int Size
+            {
+                [MethodImpl(MethodImplOptions.AggressiveInlining)]
+                get => _spilled != 0 ? _heap.Size : (int)_inlineSize;
+            }
+
+            public readonly unsafe godot_variant* Elements
+            {
+                [MethodImpl(MethodImplOptions.AggressiveInlining)]
+                get => _spilled != 0
+                    ? _heap._ptr
+                    : (godot_variant*)((byte*)Unsafe.AsPointer(ref Unsafe.AsRef(in this)) + sizeof(InlineVariantVector));
+            }
+        }
+
         public readonly unsafe godot_variant* Elements
         {
             [MethodImpl(MethodImplOptions.AggressiveInlining)]
-            get => _p->_arrayVector._ptr;
+            get => _p->_arrayVector.Elements;
         }
 
         public readonly unsafe bool IsAllocated
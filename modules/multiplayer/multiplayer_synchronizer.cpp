@@ -31,8 +31,13 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/multiplayer_api.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif // _3D_DISABLED
+
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
 	if (p_path.get_name_count() == 0) {
 		return p_obj;
@@ -54,6 +59,7 @@ void MultiplayerSynchronizer::_stop() {
 		get_multiplayer()->object_configuration_remove(node, this);
 	}
 	reset();
+	clear_rollback_history();
 }
 
 void MultiplayerSynchronizer::_start() {
@@ -182,6 +188,269 @@ Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Obj
 	return OK;
 }
 
+// Kind of each quantized value, so a property can change type at runtime.
+enum QuantizedKind {
+	QUANTIZED_NONE, // Sent with the non-quantized values.
+	QUANTIZED_FLOAT,
+	QUANTIZED_VECTOR2,
+	QUANTIZED_VECTOR3,
+	QUANTIZED_VECTOR4,
+	QUANTIZED_QUATERNION, // Smallest three.
+};
+
+static constexpr int QUANTIZED_KIND_BITS = 3;
+
+struct StateBitWriter {
+	uint8_t *buffer = nullptr; // May be null to only compute the length.
+	uint64_t bit = 0;
+
+	void write(uint32_t p_value, int p_bits) {
+		for (int i = 0; i < p_bits; i++, bit++) {
+			if (!buffer) {
+				continue;
+			}
+			uint8_t &byte = buffer[bit >> 3];
+			if ((bit & 7) == 0) {
+				byte = 0;
+			}
+			byte |= ((p_value >> i) & 1) << (bit & 7);
+		}
+	}
+
+	void write_unit(double p_value, double p_min, double p_max, int p_bits) {
+		const uint64_t steps = (uint64_t(1) << p_bits) - 1;
+		double t = (p_value - p_min) / (p_max - p_min);
+		if (!(t > 0.0)) { // Also catches NaN.
+			t = 0.0;
+		} else if (t > 1.0) {
+			t = 1.0;
+		}
+		write(uint32_t(Math::round(t * steps)), p_bits);
+	}
+
+	int get_byte_length() const { return (bit + 7) >> 3; }
+
+	StateBitWriter(uint8_t *p_buffer) { buffer = p_buffer; }
+};
+
+struct StateBitReader {
+	const uint8_t *buffer = nullptr;
+	uint64_t bit = 0;
+	uint64_t bit_count = 0;
+
+	bool read(uint32_t &r_value, int p_bits) {
+		if (bit + p_bits > bit_count) {
+			return false;
+		}
+		r_value = 0;
+		for (int i = 0; i < p_bits; i++, bit++) {
+			r_value |= uint32_t((buffer[bit >> 3] >> (bit & 7)) & 1) << i;
+		}
+		return true;
+	}
+
+	bool read_unit(real_t &r_value, double p_min, double p_max, int p_bits) {
+		uint32_t q = 0;
+		if (!read(q, p_bits)) {
+			return false;
+		}
+		const uint64_t steps = (uint64_t(1) << p_bits) - 1;
+		r_value = p_min + (p_max - p_min) * (double(q) / steps);
+		return true;
+	}
+
+	int get_byte_length() const { return (bit + 7) >> 3; }
+
+	StateBitReader(const uint8_t *p_buffer, int p_len) {
+		buffer = p_buffer;
+		bit_count = uint64_t(p_len) * 8;
+	}
+};
+
+static QuantizedKind _get_quantized_kind(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return QUANTIZED_FLOAT;
+		case Variant::VECTOR2:
+			return QUANTIZED_VECTOR2;
+		case Variant::VECTOR3:
+			return QUANTIZED_VECTOR3;
+		case Variant::VECTOR4:
+			return QUANTIZED_VECTOR4;
+		case Variant::QUATERNION:
+			return QUANTIZED_QUATERNION;
+		default:
+			return QUANTIZED_NONE;
+	}
+}
+
+Error MultiplayerSynchronizer::encode_state(const Variant **p_state, int p_count, const SceneReplicationConfig::PropertyQuantization *p_quantization, uint8_t *p_buffer, int &r_len) {
+	bool quantized = false;
+	for (int i = 0; i < p_count && !quantized; i++) {
+		quantized = p_quantization[i].bits > 0;
+	}
+	if (!quantized) {
+		return MultiplayerAPI::encode_and_compress_variants(p_state, p_count, p_buffer, r_len);
+	}
+
+	StateBitWriter writer(p_buffer);
+	LocalVector<const Variant *> others;
+	for (int i = 0; i < p_count; i++) {
+		const Variant &value = *p_state[i];
+		const int bits = p_quantization[i].bits;
+		if (bits == 0) {
+			others.push_back(p_state[i]);
+			continue;
+		}
+
+		const QuantizedKind kind = _get_quantized_kind(value.get_type());
+		writer.write(kind, QUANTIZED_KIND_BITS);
+		const real_t min = p_quantization[i].range.x;
+		const real_t max = p_quantization[i].range.y;
+		switch (kind) {
+			case QUANTIZED_NONE: {
+				others.push_back(p_state[i]);
+			} break;
+			case QUANTIZED_FLOAT: {
+				writer.write_unit(value.operator double(), min, max, bits);
+			} break;
+			case QUANTIZED_VECTOR2: {
+				const Vector2 v = value;
+				for (int j = 0; j < 2; j++) {
+					writer.write_unit(v[j], min, max, bits);
+				}
+			} break;
+			case QUANTIZED_VECTOR3: {
+				const Vector3 v = value;
+				for (int j = 0; j < 3; j++) {
+					writer.write_unit(v[j], min, max, bits);
+				}
+			} break;
+			case QUANTIZED_VECTOR4: {
+				const Vector4 v = value;
+				for (int j = 0; j < 4; j++) {
+					writer.write_unit(v[j], min, max, bits);
+				}
+			} break;
+			case QUANTIZED_QUATERNION: {
+				// Drop the largest component, it can be recomputed from the others since the quaternion is normalized.
+				Quaternion q = value;
+				q = q.length_squared() > 0 ? q.normalized() : Quaternion();
+				int largest = 0;
+				for (int j = 1; j < 4; j++) {
+					if (Math::abs(q.components[j]) > Math::abs(q.components[largest])) {
+						largest = j;
+					}
+				}
+				const real_t sign = q.components[largest] < 0 ? -1 : 1;
+				writer.write(largest, 2);
+				for (int j = 0; j < 4; j++) {
+					if (j != largest) {
+						writer.write_unit(q.components[j] * sign, -Math_SQRT12, Math_SQRT12, bits);
+					}
+				}
+			} break;
+		}
+	}
+
+	const int ofs = writer.get_byte_length();
+	int size = 0;
+	if (others.size()) {
+		Error err = MultiplayerAPI::encode_and_compress_variants(others.ptr(), others.size(), p_buffer ? p_buffer + ofs : nullptr, size);
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	r_len = ofs + size;
+	return OK;
+}
+
+Error MultiplayerSynchronizer::decode_state(Vector<Variant> &r_state, const SceneReplicationConfig::PropertyQuantization *p_quantization, const uint8_t *p_buffer, int p_len, int &r_len) {
+	bool quantized = false;
+	for (int i = 0; i < r_state.size() && !quantized; i++) {
+		quantized = p_quantization[i].bits > 0;
+	}
+	if (!quantized) {
+		return MultiplayerAPI::decode_and_decompress_variants(r_state, p_buffer, p_len, r_len);
+	}
+
+	StateBitReader reader(p_buffer, p_len);
+	LocalVector<int> others;
+	Variant *state = r_state.ptrw();
+	for (int i = 0; i < r_state.size(); i++) {
+		const int bits = p_quantization[i].bits;
+		if (bits == 0) {
+			others.push_back(i);
+			continue;
+		}
+
+		uint32_t kind = QUANTIZED_NONE;
+		ERR_FAIL_COND_V(!reader.read(kind, QUANTIZED_KIND_BITS), ERR_INVALID_DATA);
+		const real_t min = p_quantization[i].range.x;
+		const real_t max = p_quantization[i].range.y;
+		switch (kind) {
+			case QUANTIZED_NONE: {
+				others.push_back(i);
+			} break;
+			case QUANTIZED_FLOAT: {
+				real_t v = 0;
+				ERR_FAIL_COND_V(!reader.read_unit(v, min, max, bits), ERR_INVALID_DATA);
+				state[i] = v;
+			} break;
+			case QUANTIZED_VECTOR2: {
+				Vector2 v;
+				for (int j = 0; j < 2; j++) {
+					ERR_FAIL_COND_V(!reader.read_unit(v[j], min, max, bits), ERR_INVALID_DATA);
+				}
+				state[i] = v;
+			} break;
+			case QUANTIZED_VECTOR3: {
+				Vector3 v;
+				for (int j = 0; j < 3; j++) {
+					ERR_FAIL_COND_V(!reader.read_unit(v[j], min, max, bits), ERR_INVALID_DATA);
+				}
+				state[i] = v;
+			} break;
+			case QUANTIZED_VECTOR4: {
+				Vector4 v;
+				for (int j = 0; j < 4; j++) {
+					ERR_FAIL_COND_V(!reader.read_unit(v[j], min, max, bits), ERR_INVALID_DATA);
+				}
+				state[i] = v;
+			} break;
+			case QUANTIZED_QUATERNION: {
+				uint32_t largest = 0;
+				ERR_FAIL_COND_V(!reader.read(largest, 2), ERR_INVALID_DATA);
+				Quaternion q;
+				real_t sum = 0;
+				for (uint32_t j = 0; j < 4; j++) {
+					if (j != largest) {
+						ERR_FAIL_COND_V(!reader.read_unit(q.components[j], -Math_SQRT12, Math_SQRT12, bits), ERR_INVALID_DATA);
+						sum += q.components[j] * q.components[j];
+					}
+				}
+				q.components[largest] = Math::sqrt(MAX(0, 1 - sum));
+				state[i] = q.normalized();
+			} break;
+			default: {
+				ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid quantized state.");
+			}
+		}
+	}
+
+	const int ofs = reader.get_byte_length();
+	int size = 0;
+	if (others.size()) {
+		Vector<Variant> values;
+		values.resize(others.size());
+		Error err = MultiplayerAPI::decode_and_decompress_variants(values, p_buffer + ofs, p_len - ofs, size);
+		ERR_FAIL_COND_V(err != OK, err);
+		for (uint32_t i = 0; i < others.size(); i++) {
+			state[others[i]] = values[i];
+		}
+	}
+	r_len = ofs + size;
+	return OK;
+}
+
 bool MultiplayerSynchronizer::is_visibility_public() const {
 	return peer_visibility.has(0);
 }
@@ -242,6 +511,218 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_spatial_interest_enabled(bool p_enabled) {
+	spatial_interest = p_enabled;
+}
+
+bool MultiplayerSynchronizer::is_spatial_interest_enabled() const {
+	return spatial_interest;
+}
+
+void MultiplayerSynchronizer::set_sync_priority(real_t p_priority) {
+	ERR_FAIL_COND_MSG(p_priority < 0, "Sync priority must be greater or equal to 0.");
+	sync_priority = p_priority;
+}
+
+real_t MultiplayerSynchronizer::get_sync_priority() const {
+	return sync_priority;
+}
+
+bool MultiplayerSynchronizer::get_interest_position(Vector3 &r_position) {
+	Node *node = get_root_node();
+	if (!node) {
+		return false;
+	}
+#ifndef _3D_DISABLED
+	if (const Node3D *node_3d = Object::cast_to<Node3D>(node)) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+#endif // _3D_DISABLED
+	if (const Node2D *node_2d = Object::cast_to<Node2D>(node)) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+void MultiplayerSynchronizer::set_rollback_history(int p_ticks) {
+	ERR_FAIL_COND_MSG(p_ticks < 0, "Rollback history must be greater or equal to 0 (where 0 means disabled).");
+	rollback_frames.clear();
+	rollback_frames.resize(p_ticks);
+}
+
+int MultiplayerSynchronizer::get_rollback_history() const {
+	return rollback_frames.size();
+}
+
+void MultiplayerSynchronizer::clear_rollback_history() {
+	for (RollbackFrame &frame : rollback_frames) {
+		frame = RollbackFrame();
+	}
+}
+
+Error MultiplayerSynchronizer::_update_rollback_properties(Node *p_root) {
+	// The targets and accessors are resolved once per config, and again when the root, the config, or a target changes.
+	bool valid = rollback_properties_root == p_root->get_instance_id() && rollback_properties_config == replication_config->get_instance_id() && rollback_properties_version == replication_config->get_version();
+	for (uint32_t i = 0; valid && i < rollback_properties.size(); i++) {
+		rollback_properties[i].object = ObjectDB::get_instance(rollback_properties[i].target);
+		valid = rollback_properties[i].object != nullptr;
+	}
+	if (valid) {
+		return OK;
+	}
+
+	if (rollback_properties_config.is_valid() && (rollback_properties_config != replication_config->get_instance_id() || rollback_properties_version != replication_config->get_version())) {
+		clear_rollback_history(); // The recorded states follow the previous property list.
+	}
+	rollback_properties.clear();
+	rollback_properties_root = ObjectID();
+	rollback_properties_config = ObjectID();
+	const List<NodePath> *lists[] = { &replication_config->get_sync_properties(), &replication_config->get_watch_properties() };
+	for (const List<NodePath> *list : lists) {
+		for (const NodePath &path : *list) {
+			Object *obj = _get_prop_target(p_root, path);
+			ERR_FAIL_NULL_V(obj, FAILED);
+			RollbackProperty prop;
+			prop.target = obj->get_instance_id();
+			prop.object = obj;
+			prop.path = path;
+			prop.subnames = path.get_subnames();
+			ERR_FAIL_COND_V_MSG(prop.subnames.is_empty(), ERR_INVALID_DATA, vformat("Property '%s' not found.", path));
+			// Plain native properties are accessed through their bound methods, unless a script may override them.
+			ScriptInstance *script = obj->get_script_instance();
+			bool script_property = false;
+			if (script) {
+				script->get_property_type(prop.subnames[0], &script_property);
+			}
+			bool is_valid = false;
+			const StringName class_name = obj->get_class_name();
+			if (prop.subnames.size() == 1 && !script_property && ClassDB::get_property_index(class_name, prop.subnames[0], &is_valid) < 0 && is_valid) {
+				const StringName getter = ClassDB::get_property_getter(class_name, prop.subnames[0]);
+				const StringName setter = ClassDB::get_property_setter(class_name, prop.subnames[0]);
+				prop.getter = getter == StringName() ? nullptr : ClassDB::get_method(class_name, getter);
+				prop.setter = setter == StringName() ? nullptr : ClassDB::get_method(class_name, setter);
+			}
+			rollback_properties.push_back(prop);
+		}
+	}
+	rollback_properties_root = p_root->get_instance_id();
+	rollback_properties_config = replication_config->get_instance_id();
+	rollback_properties_version = replication_config->get_version();
+	return OK;
+}
+
+MultiplayerSynchronizer::RollbackFrame *MultiplayerSynchronizer::_get_rollback_frame(int64_t p_tick, bool p_create) {
+	ERR_FAIL_COND_V(p_tick < 0, nullptr);
+	if (rollback_frames.is_empty()) {
+		return nullptr;
+	}
+	RollbackFrame &frame = rollback_frames[p_tick % rollback_frames.size()];
+	if (frame.tick == p_tick) {
+		return &frame;
+	}
+	if (!p_create || frame.tick > p_tick) {
+		return nullptr; // Not recorded, or older than the history.
+	}
+	frame.tick = p_tick;
+	frame.state.clear(); // Keeps the allocation for the next record.
+	frame.input = Variant();
+	return &frame;
+}
+
+const MultiplayerSynchronizer::RollbackFrame *MultiplayerSynchronizer::_find_rollback_frame(int64_t p_tick) const {
+	if (p_tick < 0 || rollback_frames.is_empty()) {
+		return nullptr;
+	}
+	const RollbackFrame &frame = rollback_frames[p_tick % rollback_frames.size()];
+	return frame.tick == p_tick ? &frame : nullptr;
+}
+
+Error MultiplayerSynchronizer::record_state(int64_t p_tick) {
+	ERR_FAIL_COND_V_MSG(rollback_frames.is_empty(), ERR_UNCONFIGURED, "The rollback history is disabled.");
+	ERR_FAIL_COND_V(replication_config.is_null(), ERR_UNCONFIGURED);
+	Node *root = get_root_node();
+	ERR_FAIL_NULL_V(root, ERR_UNCONFIGURED);
+	Error err = _update_rollback_properties(root);
+	ERR_FAIL_COND_V(err != OK, err);
+	RollbackFrame *frame = _get_rollback_frame(p_tick, true);
+	ERR_FAIL_NULL_V_MSG(frame, ERR_INVALID_PARAMETER, vformat("Tick %d is older than the rollback history.", p_tick));
+
+	// Values are kept as they are, they are only encoded when sent.
+	frame->state.resize(rollback_properties.size());
+	for (uint32_t i = 0; i < rollback_properties.size(); i++) {
+		const RollbackProperty &prop = rollback_properties[i];
+		bool valid = true;
+		if (prop.getter) {
+			Callable::CallError ce;
+			frame->state[i] = prop.getter->call(prop.object, nullptr, 0, ce);
+			valid = ce.error == Callable::CallError::CALL_OK;
+		} else {
+			frame->state[i] = prop.object->get_indexed(prop.subnames, &valid);
+		}
+		if (unlikely(!valid)) {
+			frame->state.clear();
+			ERR_FAIL_V_MSG(ERR_INVALID_DATA, vformat("Property '%s' not found.", prop.path));
+		}
+	}
+	return OK;
+}
+
+Error MultiplayerSynchronizer::restore_state(int64_t p_tick) {
+	ERR_FAIL_COND_V(replication_config.is_null(), ERR_UNCONFIGURED);
+	Node *root = get_root_node();
+	ERR_FAIL_NULL_V(root, ERR_UNCONFIGURED);
+	Error err = _update_rollback_properties(root);
+	ERR_FAIL_COND_V(err != OK, err);
+	const RollbackFrame *frame = _find_rollback_frame(p_tick);
+	ERR_FAIL_COND_V_MSG(!frame || frame->state.is_empty(), ERR_DOES_NOT_EXIST, vformat("No state recorded for tick %d.", p_tick));
+	ERR_FAIL_COND_V(frame->state.size() != rollback_properties.size(), ERR_BUG);
+
+	for (uint32_t i = 0; i < rollback_properties.size(); i++) {
+		const RollbackProperty &prop = rollback_properties[i];
+		if (prop.setter) {
+			const Variant *arg = &frame->state[i];
+			Callable::CallError ce;
+			prop.setter->call(prop.object, &arg, 1, ce);
+		} else {
+			prop.object->set_indexed(prop.subnames, frame->state[i]);
+		}
+	}
+	return OK;
+}
+
+bool MultiplayerSynchronizer::has_state(int64_t p_tick) const {
+	const RollbackFrame *frame = _find_rollback_frame(p_tick);
+	return frame && !frame->state.is_empty();
+}
+
+void MultiplayerSynchronizer::set_input(int64_t p_tick, const Variant &p_input) {
+	ERR_FAIL_COND_MSG(rollback_frames.is_empty(), "The rollback history is disabled.");
+	RollbackFrame *frame = _get_rollback_frame(p_tick, true);
+	ERR_FAIL_NULL_MSG(frame, vformat("Tick %d is older than the rollback history.", p_tick));
+	frame->input = p_input;
+}
+
+Variant MultiplayerSynchronizer::get_input(int64_t p_tick) const {
+	const RollbackFrame *frame = _find_rollback_frame(p_tick);
+	return frame ? frame->input : Variant();
+}
+
+Error MultiplayerSynchronizer::resimulate(int64_t p_from_tick, int64_t p_to_tick) {
+	ERR_FAIL_COND_V(p_to_tick < p_from_tick, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(p_to_tick - p_from_tick >= (int64_t)rollback_frames.size(), ERR_INVALID_PARAMETER, "Can't resimulate more ticks than the rollback history.");
+	Error err = restore_state(p_from_tick);
+	ERR_FAIL_COND_V(err != OK, err);
+	for (int64_t tick = p_from_tick + 1; tick <= p_to_tick; tick++) {
+		emit_signal(SNAME("resimulate_tick"), tick, get_input(tick));
+		err = record_state(tick);
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -267,12 +748,30 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_spatial_interest_enabled", "enabled"), &MultiplayerSynchronizer::set_spatial_interest_enabled);
+	ClassDB::bind_method(D_METHOD("is_spatial_interest_enabled"), &MultiplayerSynchronizer::is_spatial_interest_enabled);
+	ClassDB::bind_method(D_METHOD("set_sync_priority", "priority"), &MultiplayerSynchronizer::set_sync_priority);
+	ClassDB::bind_method(D_METHOD("get_sync_priority"), &MultiplayerSynchronizer::get_sync_priority);
+
+	ClassDB::bind_method(D_METHOD("set_rollback_history", "ticks"), &MultiplayerSynchronizer::set_rollback_history);
+	ClassDB::bind_method(D_METHOD("get_rollback_history"), &MultiplayerSynchronizer::get_rollback_history);
+	ClassDB::bind_method(D_METHOD("clear_rollback_history"), &MultiplayerSynchronizer::clear_rollback_history);
+	ClassDB::bind_method(D_METHOD("record_state", "tick"), &MultiplayerSynchronizer::record_state);
+	ClassDB::bind_method(D_METHOD("restore_state", "tick"), &MultiplayerSynchronizer::restore_state);
+	ClassDB::bind_method(D_METHOD("has_state", "tick"), &MultiplayerSynchronizer::has_state);
+	ClassDB::bind_method(D_METHOD("set_input", "tick", "input"), &MultiplayerSynchronizer::set_input);
+	ClassDB::bind_method(D_METHOD("get_input", "tick"), &MultiplayerSynchronizer::get_input);
+	ClassDB::bind_method(D_METHOD("resimulate", "from_tick", "to_tick"), &MultiplayerSynchronizer::resimulate);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "spatial_interest"), "set_spatial_interest_enabled", "is_spatial_interest_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "sync_priority", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"), "set_sync_priority", "get_sync_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "rollback_history", PROPERTY_HINT_RANGE, "0,256,1,or_greater,suffix:ticks"), "set_rollback_history", "get_rollback_history");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -281,6 +780,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("synchronized"));
 	ADD_SIGNAL(MethodInfo("delta_synchronized"));
 	ADD_SIGNAL(MethodInfo("visibility_changed", PropertyInfo(Variant::INT, "for_peer")));
+	ADD_SIGNAL(MethodInfo("resimulate_tick", PropertyInfo(Variant::INT, "tick"), PropertyInfo(Variant::NIL, "input", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NIL_IS_VARIANT)));
 }
 
 void MultiplayerSynchronizer::_notification(int p_what) {
@@ -433,6 +933,18 @@ List<Variant> MultiplayerSynchronizer::get_delta_state(uint64_t p_cur_usec, uint
 	return out;
 }
 
+Vector<SceneReplicationConfig::PropertyQuantization> MultiplayerSynchronizer::get_delta_quantization(uint64_t p_indexes) {
+	Vector<SceneReplicationConfig::PropertyQuantization> out;
+	ERR_FAIL_COND_V(replication_config.is_null(), out);
+	const Vector<SceneReplicationConfig::PropertyQuantization> &quantization = replication_config->get_watch_quantization();
+	for (int i = 0; i < quantization.size(); i++) {
+		if (p_indexes & (1ULL << i)) {
+			out.push_back(quantization[i]);
+		}
+	}
+	return out;
+}
+
 List<NodePath> MultiplayerSynchronizer::get_delta_properties(uint64_t p_indexes) {
 	List<NodePath> out;
 	ERR_FAIL_COND_V(replication_config.is_null(), out);
@@ -32,6 +32,7 @@
 
 #include "scene_replication_config.h"
 
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class MultiplayerSynchronizer : public Node {
@@ -51,11 +52,28 @@ private:
 		Variant value;
 	};
 
+	struct RollbackFrame {
+		int64_t tick = -1;
+		LocalVector<Variant> state; // Sync and watch property values. Empty if not recorded.
+		Variant input;
+	};
+
+	struct RollbackProperty {
+		ObjectID target;
+		Object *object = nullptr; // Resolved from target each time the cache is checked.
+		NodePath path;
+		Vector<StringName> subnames;
+		MethodBind *getter = nullptr; // Null if the property goes through get_indexed().
+		MethodBind *setter = nullptr; // Null if the property goes through set_indexed().
+	};
+
 	Ref<SceneReplicationConfig> replication_config;
 	NodePath root_path = NodePath(".."); // Start with parent, like with AnimationPlayer.
 	uint64_t sync_interval_usec = 0;
 	uint64_t delta_interval_usec = 0;
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
+	bool spatial_interest = false;
+	real_t sync_priority = 1.0;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
 	Vector<Watcher> watchers;
@@ -67,11 +85,20 @@ private:
 	uint32_t net_id = 0;
 	bool sync_started = false;
 
+	LocalVector<RollbackFrame> rollback_frames; // Indexed by tick modulo the history size.
+	LocalVector<RollbackProperty> rollback_properties; // Sync then watch properties.
+	ObjectID rollback_properties_root;
+	ObjectID rollback_properties_config;
+	uint64_t rollback_properties_version = 0;
+
 	static Object *_get_prop_target(Object *p_obj, const NodePath &p_prop);
 	void _start();
 	void _stop();
 	void _update_process();
 	Error _watch_changes(uint64_t p_usec);
+	Error _update_rollback_properties(Node *p_root);
+	RollbackFrame *_get_rollback_frame(int64_t p_tick, bool p_create);
+	const RollbackFrame *_find_rollback_frame(int64_t p_tick) const;
 
 protected:
 	static void _bind_methods();
@@ -81,6 +108,10 @@ public:
 	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs);
 	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state);
 
+	// Quantized values are bit-packed first, the others follow as compressed variants.
+	static Error encode_state(const Variant **p_state, int p_count, const SceneReplicationConfig::PropertyQuantization *p_quantization, uint8_t *p_buffer, int &r_len);
+	static Error decode_state(Vector<Variant> &r_state, const SceneReplicationConfig::PropertyQuantization *p_quantization, const uint8_t *p_buffer, int p_len, int &r_len);
+
 	void reset();
 	Node *get_root_node();
 
@@ -116,8 +147,25 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_spatial_interest_enabled(bool p_enabled);
+	bool is_spatial_interest_enabled() const;
+	void set_sync_priority(real_t p_priority);
+	real_t get_sync_priority() const;
+	bool get_interest_position(Vector3 &r_position);
+
+	void set_rollback_history(int p_ticks);
+	int get_rollback_history() const;
+	void clear_rollback_history();
+	Error record_state(int64_t p_tick);
+	Error restore_state(int64_t p_tick);
+	bool has_state(int64_t p_tick) const;
+	void set_input(int64_t p_tick, const Variant &p_input);
+	Variant get_input(int64_t p_tick) const;
+	Error resimulate(int64_t p_from_tick, int64_t p_to_tick);
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
+	Vector<SceneReplicationConfig::PropertyQuantization> get_delta_quantization(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
 
 	MultiplayerSynchronizer();
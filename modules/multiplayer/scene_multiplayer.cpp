@@ -80,6 +80,9 @@ Error SceneMultiplayer::poll() {
 		return OK;
 	}
 
+	// Send the RPCs batched since the last poll.
+	rpc->flush_batches();
+
 	while (multiplayer_peer->get_available_packet_count()) {
 		int sender = multiplayer_peer->get_packet_peer();
 		const uint8_t *packet;
@@ -165,6 +168,8 @@ Error SceneMultiplayer::poll() {
 	}
 
 	replicator->on_network_process();
+	// And the ones called while processing packets.
+	rpc->flush_batches();
 	return OK;
 }
 
@@ -173,6 +178,7 @@ void SceneMultiplayer::clear() {
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	rpc->clear_batches();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -422,6 +428,7 @@ void SceneMultiplayer::_del_peer(int p_id) {
 		}
 	}
 
+	rpc->on_peer_change(p_id, false);
 	replicator->on_peer_change(p_id, false);
 	cache->on_peer_change(p_id, false);
 	connected_peers.erase(p_id);
@@ -637,6 +644,38 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_rpc_batching_enabled(bool p_enabled) {
+	rpc->set_batching_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_batching_enabled() const {
+	return rpc->is_batching_enabled();
+}
+
+void SceneMultiplayer::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	replicator->set_peer_interest(p_peer, p_origin, p_radius);
+}
+
+void SceneMultiplayer::clear_peer_interest(int p_peer) {
+	replicator->clear_peer_interest(p_peer);
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
+void SceneMultiplayer::set_max_sync_bytes_per_peer(int p_bytes) {
+	replicator->set_max_sync_bytes_per_peer(p_bytes);
+}
+
+int SceneMultiplayer::get_max_sync_bytes_per_peer() const {
+	return replicator->get_max_sync_bytes_per_peer();
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -665,6 +704,15 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("set_rpc_batching_enabled", "enabled"), &SceneMultiplayer::set_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_rpc_batching_enabled"), &SceneMultiplayer::is_rpc_batching_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_peer_interest", "id", "origin", "radius"), &SceneMultiplayer::set_peer_interest);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest", "id"), &SceneMultiplayer::clear_peer_interest);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_max_sync_bytes_per_peer", "bytes"), &SceneMultiplayer::set_max_sync_bytes_per_peer);
+	ClassDB::bind_method(D_METHOD("get_max_sync_bytes_per_peer"), &SceneMultiplayer::get_max_sync_bytes_per_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -672,8 +720,11 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_object_decoding"), "set_allow_object_decoding", "is_object_decoding_allowed");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "refuse_new_connections"), "set_refuse_new_connections", "is_refusing_new_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_batching"), "set_rpc_batching_enabled", "is_rpc_batching_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_bytes_per_peer", PROPERTY_HINT_RANGE, "0,65536,1,or_greater,suffix:B"), "set_max_sync_bytes_per_peer", "get_max_sync_bytes_per_peer");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "0.001,1024,0.001,or_greater"), "set_interest_cell_size", "get_interest_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
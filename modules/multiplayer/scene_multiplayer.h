@@ -183,6 +183,7 @@ public:
 	String get_rpc_md5(const Object *p_obj);
 
 	const HashSet<int> get_connected_peers() const { return connected_peers; }
+	bool has_connected_peer(int p_peer) const { return connected_peers.has(p_peer); }
 
 	void set_remote_sender_override(int p_id) { remote_sender_override = p_id; }
 	void set_refuse_new_connections(bool p_refuse);
@@ -200,6 +201,18 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_rpc_batching_enabled(bool p_enabled);
+	bool is_rpc_batching_enabled() const;
+
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_max_sync_bytes_per_peer(int p_bytes);
+	int get_max_sync_bytes_per_peer() const;
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
@@ -45,11 +45,17 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	struct PropertyQuantization {
+		int bits = 0; // Zero means the value is sent as is.
+		Vector2 range = Vector2(-1, 1);
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		PropertyQuantization quantization;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -66,7 +72,10 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	Vector<PropertyQuantization> sync_quantization;
+	Vector<PropertyQuantization> watch_quantization;
 	bool dirty = false;
+	uint64_t version = 0; // Incremented each time the property lists are rebuilt.
 
 	void _update();
 
@@ -99,10 +108,22 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	int property_get_quantization_bits(const NodePath &p_path);
+	void property_set_quantization_bits(const NodePath &p_path, int p_bits);
+
+	Vector2 property_get_quantization_range(const NodePath &p_path);
+	void property_set_quantization_range(const NodePath &p_path, const Vector2 &p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
 
+	// Aligned with get_sync_properties() and get_watch_properties().
+	const Vector<PropertyQuantization> &get_sync_quantization();
+	const Vector<PropertyQuantization> &get_watch_quantization();
+
+	uint64_t get_version();
+
 	SceneReplicationConfig() {}
 };
 
@@ -143,8 +143,16 @@ void SceneReplicationInterface::on_network_process() {
 
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
+	for (const KeyValue<int, PeerInfo> &E : peers_info) {
+		if (E.value.has_interest) {
+			_update_interest_grid();
+			break;
+		}
+	}
+	LocalVector<ObjectID> to_sync;
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
-		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
+		to_sync.clear();
+		_get_relevant_synchronizers(E.value, to_sync);
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
 		}
@@ -154,6 +162,105 @@ void SceneReplicationInterface::on_network_process() {
 	}
 }
 
+Vector3i SceneReplicationInterface::_get_interest_cell(const Vector3 &p_position) const {
+	return Vector3i((p_position / interest_cell_size).floor());
+}
+
+void SceneReplicationInterface::_update_interest_grid() {
+	interest_grid.clear();
+	interest_positions.clear();
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		if (!sync || !sync->is_spatial_interest_enabled() || !_has_authority(sync)) {
+			continue;
+		}
+		Vector3 position;
+		if (!sync->get_interest_position(position)) {
+			continue;
+		}
+		interest_positions[sid] = position;
+		interest_grid[_get_interest_cell(position)].push_back(sid);
+	}
+}
+
+void SceneReplicationInterface::_get_relevant_synchronizers(PeerInfo &p_info, LocalVector<ObjectID> &r_synchronizers) {
+	if (!p_info.has_interest && sync_budget <= 0) {
+		// Plain visibility.
+		for (const ObjectID &sid : p_info.sync_nodes) {
+			r_synchronizers.push_back(sid);
+		}
+		return;
+	}
+
+	// Distance (relative to the radius) of the spatial synchronizers within the area of interest.
+	AHashMap<ObjectID, real_t> &in_range = interest_in_range;
+	in_range.clear();
+	if (p_info.has_interest) {
+		const real_t radius_squared = p_info.interest_radius * p_info.interest_radius;
+		auto check_cell = [&](const LocalVector<ObjectID> &p_cell) {
+			for (const ObjectID &sid : p_cell) {
+				const real_t distance_squared = interest_positions[sid].distance_squared_to(p_info.interest_origin);
+				if (distance_squared <= radius_squared && p_info.sync_nodes.has(sid)) {
+					in_range[sid] = p_info.interest_radius > 0 ? Math::sqrt(distance_squared) / p_info.interest_radius : 0;
+				}
+			}
+		};
+
+		const real_t span = 2 * p_info.interest_radius / interest_cell_size + 1;
+		if (span * span * span > interest_grid.size()) {
+			// Large area, faster to go through the populated cells.
+			for (const KeyValue<Vector3i, LocalVector<ObjectID>> &E : interest_grid) {
+				check_cell(E.value);
+			}
+		} else {
+			const Vector3 extents = Vector3(1, 1, 1) * p_info.interest_radius;
+			const Vector3i from = _get_interest_cell(p_info.interest_origin - extents);
+			const Vector3i to = _get_interest_cell(p_info.interest_origin + extents);
+			for (int x = from.x; x <= to.x; x++) {
+				for (int y = from.y; y <= to.y; y++) {
+					for (int z = from.z; z <= to.z; z++) {
+						const LocalVector<ObjectID> *cell = interest_grid.getptr(Vector3i(x, y, z));
+						if (cell) {
+							check_cell(*cell);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	LocalVector<SyncCandidate> &candidates = sync_candidates;
+	candidates.clear();
+	for (const ObjectID &sid : p_info.sync_nodes) {
+		real_t relevance = 1;
+		if (p_info.has_interest && interest_positions.has(sid)) {
+			const real_t *distance = in_range.getptr(sid);
+			if (!distance) {
+				p_info.sync_priorities.erase(sid);
+				continue; // Out of the area of interest.
+			}
+			relevance = 2 - *distance; // Closer is more relevant.
+		}
+		if (sync_budget <= 0) {
+			r_synchronizers.push_back(sid);
+			continue;
+		}
+		// Accumulate priority over frames, so less relevant synchronizers are eventually sent.
+		const MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		real_t &priority = p_info.sync_priorities[sid];
+		priority += sync->get_sync_priority() * relevance;
+		candidates.push_back({ sid, priority });
+	}
+
+	if (candidates.size()) {
+		candidates.sort();
+		for (const SyncCandidate &candidate : candidates) {
+			r_synchronizers.push_back(candidate.id);
+		}
+	}
+}
+
 Error SceneReplicationInterface::on_spawn(Object *p_obj, Variant p_config) {
 	Node *node = Object::cast_to<Node>(p_obj);
 	ERR_FAIL_COND_V(!node || p_config.get_type() != Variant::OBJECT, ERR_INVALID_PARAMETER);
@@ -283,6 +390,7 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.sync_priorities.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -361,6 +469,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.sync_priorities.erase(sid);
 			}
 		}
 		return OK;
@@ -374,6 +483,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].sync_priorities.erase(sid);
 		}
 		return OK;
 	}
@@ -708,7 +818,7 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 	return sync;
 }
 
-void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
+void SceneReplicationInterface::_send_delta(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
 	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT);
@@ -736,8 +846,10 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			vptr[i] = &v;
 			i++;
 		}
+		const Vector<SceneReplicationConfig::PropertyQuantization> quantization = sync->get_delta_quantization(indexes);
+		ERR_CONTINUE(quantization.size() != varp.size());
 		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		Error err = MultiplayerSynchronizer::encode_state(vptr, varp.size(), quantization.ptr(), nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
@@ -751,7 +863,7 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint64(indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			MultiplayerSynchronizer::encode_state(vptr, varp.size(), quantization.ptr(), &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -783,10 +895,12 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		}
 		List<NodePath> props = sync->get_delta_properties(indexes);
 		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
+		const Vector<SceneReplicationConfig::PropertyQuantization> quantization = sync->get_delta_quantization(indexes);
+		ERR_FAIL_COND_V(quantization.size() != props.size(), ERR_INVALID_DATA);
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err = MultiplayerSynchronizer::decode_state(vars, quantization.ptr(), p_buffer + ofs, size, consumed);
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
@@ -800,11 +914,12 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 	return OK;
 }
 
-void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
+void SceneReplicationInterface::_send_sync(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
 	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 4 + sync_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC;
 	int ofs = 1;
+	int budget_left = sync_budget;
 	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
 	// Can only send updates for already notified nodes.
 	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
@@ -826,12 +941,20 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+		const SceneReplicationConfig::PropertyQuantization *quantization = sync->get_replication_config_ptr()->get_sync_quantization().ptr();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		err = MultiplayerSynchronizer::encode_state(varp.ptrw(), varp.size(), quantization, nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (sync_budget > 0) {
+			if (4 + 4 + size > budget_left && budget_left < sync_budget) {
+				continue; // Over budget, try the next (smaller) ones, this one will have a higher priority next time.
+			}
+			budget_left -= 4 + 4 + size;
+			peers_info[p_peer].sync_priorities[oid] = 0;
+		}
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -840,7 +963,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			MultiplayerSynchronizer::encode_state(varp.ptrw(), varp.size(), quantization, &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -885,10 +1008,11 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			continue;
 		}
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+		const SceneReplicationConfig::PropertyQuantization *quantization = sync->get_replication_config_ptr()->get_sync_quantization().ptr();
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err = MultiplayerSynchronizer::decode_state(vars, quantization, &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
@@ -918,3 +1042,36 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Interest radius must be greater or equal to 0.");
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Peer %d is not connected.", p_peer));
+	info->has_interest = true;
+	info->interest_origin = p_origin;
+	info->interest_radius = p_radius;
+}
+
+void SceneReplicationInterface::clear_peer_interest(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Peer %d is not connected.", p_peer));
+	info->has_interest = false;
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Interest cell size must be greater than 0.");
+	interest_cell_size = p_size;
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_cell_size;
+}
+
+void SceneReplicationInterface::set_max_sync_bytes_per_peer(int p_bytes) {
+	ERR_FAIL_COND_MSG(p_bytes < 0, "Sync budget must be greater or equal to 0 (where 0 means unlimited).");
+	sync_budget = p_bytes;
+}
+
+int SceneReplicationInterface::get_max_sync_bytes_per_peer() const {
+	return sync_budget;
+}
@@ -34,12 +34,14 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/object/ref_counted.h"
+#include "core/templates/a_hash_map.h"
 
 class SceneMultiplayer;
 class SceneCacheInterface;
 
 class SceneReplicationInterface : public RefCounted {
 	GDCLASS(SceneReplicationInterface, RefCounted);
+	friend class TestSceneReplicationInterfaceAccessor;
 
 private:
 	struct TrackedNode {
@@ -66,6 +68,20 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Interest management.
+		bool has_interest = false;
+		Vector3 interest_origin;
+		real_t interest_radius = 0;
+		HashMap<ObjectID, real_t> sync_priorities;
+	};
+
+	struct SyncCandidate {
+		ObjectID id;
+		real_t priority = 0;
+
+		// Highest priority first.
+		bool operator<(const SyncCandidate &p_other) const { return priority > p_other.priority; }
 	};
 
 	// Replication state.
@@ -92,6 +108,15 @@ private:
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
+	// Interest management state, rebuilt every network frame.
+	real_t interest_cell_size = 64;
+	int sync_budget = 0;
+	HashMap<Vector3i, LocalVector<ObjectID>> interest_grid;
+	HashMap<ObjectID, Vector3> interest_positions;
+	// Scratch buffers for _get_relevant_synchronizers(), reused for every peer.
+	AHashMap<ObjectID, real_t> interest_in_range;
+	LocalVector<SyncCandidate> sync_candidates;
+
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
 	void _node_ready(const ObjectID &p_oid);
@@ -100,8 +125,12 @@ private:
 	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
-	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
-	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	_FORCE_INLINE_ Vector3i _get_interest_cell(const Vector3 &p_position) const;
+	void _update_interest_grid();
+	void _get_relevant_synchronizers(PeerInfo &p_info, LocalVector<ObjectID> &r_synchronizers);
+
+	void _send_sync(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
+	void _send_delta(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
@@ -145,6 +174,15 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_max_sync_bytes_per_peer(int p_bytes);
+	int get_max_sync_bytes_per_peer() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -109,6 +109,9 @@ const SceneRPCInterface::RPCConfigCache &SceneRPCInterface::_get_node_config(con
 	}
 	RPCConfigCache cache;
 	_parse_rpc_config(p_node->get_rpc_config(), true, cache);
+	for (KeyValue<uint16_t, RPCConfig> &E : cache.configs) {
+		E.value.method = ClassDB::get_method(p_node->get_class_name(), E.value.name);
+	}
 	if (p_node->get_script_instance()) {
 		_parse_rpc_config(p_node->get_script_instance()->get_rpc_config(), false, cache);
 	}
@@ -156,10 +159,26 @@ Node *SceneRPCInterface::_process_get_node(int p_from, const uint8_t *p_packet,
 }
 
 void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	ERR_FAIL_COND_MSG(p_packet_len < 1, "Invalid packet received. Size too small.");
+	if (((p_packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT) == NETWORK_NODE_ID_BATCH) {
+		_process_batch(p_from, p_packet, p_packet_len);
+		return;
+	}
+
+	Node *node = nullptr;
+	uint16_t name_id = 0;
+	int packet_len = 0;
+	int offset = 0;
+	if (_decode_rpc_target(p_from, p_packet, p_packet_len, node, name_id, packet_len, offset)) {
+		_process_rpc(node, name_id, p_from, p_packet, packet_len, offset);
+	}
+}
+
+bool SceneRPCInterface::_decode_rpc_target(int p_from, const uint8_t *p_packet, int p_packet_len, Node *&r_node, uint16_t &r_name_id, int &r_packet_len, int &r_offset) {
 	// Extract packet meta
 	int packet_min_size = 1;
 	int name_id_offset = 1;
-	ERR_FAIL_COND_MSG(p_packet_len < packet_min_size, "Invalid packet received. Size too small.");
+	ERR_FAIL_COND_V_MSG(p_packet_len < packet_min_size, false, "Invalid packet received. Size too small.");
 	// Compute the meta size, which depends on the compression level.
 	int node_id_compression = (p_packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT;
 	int name_id_compression = (p_packet[0] & NAME_ID_COMPRESSION_FLAG) >> NAME_ID_COMPRESSION_SHIFT;
@@ -178,7 +197,7 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 			name_id_offset += 4;
 			break;
 		default:
-			ERR_FAIL_MSG("Was not possible to extract the node id compression mode.");
+			ERR_FAIL_V_MSG(false, "Was not possible to extract the node id compression mode.");
 	}
 	switch (name_id_compression) {
 		case NETWORK_NAME_ID_COMPRESSION_8:
@@ -188,9 +207,9 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 			packet_min_size += 2;
 			break;
 		default:
-			ERR_FAIL_MSG("Was not possible to extract the name id compression mode.");
+			ERR_FAIL_V_MSG(false, "Was not possible to extract the name id compression mode.");
 	}
-	ERR_FAIL_COND_MSG(p_packet_len < packet_min_size, "Invalid packet received. Size too small.");
+	ERR_FAIL_COND_V_MSG(p_packet_len < packet_min_size, false, "Invalid packet received. Size too small.");
 
 	uint32_t node_target = 0;
 	switch (node_id_compression) {
@@ -208,32 +227,104 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 			CRASH_NOW();
 	}
 
-	Node *node = _process_get_node(p_from, p_packet, node_target, p_packet_len);
-	ERR_FAIL_NULL_MSG(node, "Invalid packet received. Requested node was not found.");
+	r_node = _process_get_node(p_from, p_packet, node_target, p_packet_len);
+	ERR_FAIL_NULL_V_MSG(r_node, false, "Invalid packet received. Requested node was not found.");
 
-	uint16_t name_id = 0;
 	switch (name_id_compression) {
 		case NETWORK_NAME_ID_COMPRESSION_8:
-			name_id = p_packet[name_id_offset];
+			r_name_id = p_packet[name_id_offset];
 			break;
 		case NETWORK_NAME_ID_COMPRESSION_16:
-			name_id = decode_uint16(p_packet + name_id_offset);
+			r_name_id = decode_uint16(p_packet + name_id_offset);
 			break;
 		default:
 			// Unreachable, checked before.
 			CRASH_NOW();
 	}
 
-	const int packet_len = get_packet_len(node_target, p_packet_len);
-	_process_rpc(node, name_id, p_from, p_packet, packet_len, packet_min_size);
+	r_packet_len = get_packet_len(node_target, p_packet_len);
+	r_offset = packet_min_size;
+	return true;
 }
 
-void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset) {
-	ERR_FAIL_COND_MSG(p_offset > p_packet_len, "Invalid packet received. Size too small.");
+void SceneRPCInterface::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	// Resolves every call of the batch first, then decodes all the arguments into
+	// one buffer, and dispatches last. Malformed framing drops the whole batch.
+	struct BatchedCall {
+		ObjectID node;
+		const RPCConfig *config = nullptr;
+		const uint8_t *packet = nullptr;
+		int packet_len = 0;
+		int offset = 0;
+		int argc = 0;
+		uint32_t arg_start = 0;
+	};
+	LocalVector<BatchedCall> calls;
+	uint32_t arg_count = 0;
+
+	int ofs = 1;
+	while (ofs < p_packet_len) {
+		ERR_FAIL_COND_MSG(ofs + 2 > p_packet_len, "Invalid RPC batch received. Size too small.");
+		const int len = decode_uint16(&p_packet[ofs]);
+		ofs += 2;
+		ERR_FAIL_COND_MSG(len < 1 || ofs + len > p_packet_len, "Invalid RPC batch received. Size smaller than declared.");
+		const uint8_t *packet = &p_packet[ofs];
+		ofs += len;
+		ERR_FAIL_COND_MSG((packet[0] & SceneMultiplayer::CMD_MASK) != SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL, "Invalid RPC batch received. Only RPCs can be batched.");
+		ERR_FAIL_COND_MSG(((packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT) == NETWORK_NODE_ID_BATCH, "Invalid RPC batch received. Batches can't be nested.");
+
+		// Calls which can't be made are skipped, like separate packets would be.
+		BatchedCall call;
+		call.packet = packet;
+		Node *node = nullptr;
+		uint16_t name_id = 0;
+		if (!_decode_rpc_target(p_from, packet, len, node, name_id, call.packet_len, call.offset)) {
+			continue;
+		}
+		call.config = _get_rpc_config(node, name_id, p_from);
+		if (!call.config) {
+			continue;
+		}
+		call.argc = _decode_rpc_argc(call.packet, call.packet_len, call.offset);
+		if (call.argc < 0) {
+			continue;
+		}
+		call.node = node->get_instance_id();
+		call.arg_start = arg_count;
+		arg_count += call.argc;
+		calls.push_back(call);
+
+#ifdef DEBUG_ENABLED
+		_profile_node_data("rpc_in", call.node, call.packet_len);
+#endif
+	}
+
+	LocalVector<Variant> args;
+	LocalVector<const Variant *> argp;
+	args.resize(arg_count);
+	argp.resize(arg_count);
+	for (uint32_t i = 0; i < arg_count; i++) {
+		argp[i] = &args[i];
+	}
+	for (BatchedCall &call : calls) {
+		if (_decode_rpc_args(call.packet, call.packet_len, call.offset, args.ptr() + call.arg_start, call.argc) != OK) {
+			call.config = nullptr;
+		}
+	}
 
+	for (const BatchedCall &call : calls) {
+		// Earlier calls may have freed the node.
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(call.node));
+		if (call.config && node) {
+			_call_rpc(node, *call.config, argp.ptr() + call.arg_start, call.argc);
+		}
+	}
+}
+
+const SceneRPCInterface::RPCConfig *SceneRPCInterface::_get_rpc_config(Node *p_node, const uint16_t p_rpc_method_id, int p_from) {
 	// Check that remote can call the RPC on this node.
 	const RPCConfigCache &cache_config = _get_node_config(p_node);
-	ERR_FAIL_COND(!cache_config.configs.has(p_rpc_method_id));
+	ERR_FAIL_COND_V(!cache_config.configs.has(p_rpc_method_id), nullptr);
 	const RPCConfig &config = cache_config.configs[p_rpc_method_id];
 
 	bool can_call = false;
@@ -249,25 +340,72 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 		} break;
 	}
 
-	ERR_FAIL_COND_MSG(!can_call, "RPC '" + String(config.name) + "' is not allowed on node " + p_node->get_path() + " from: " + itos(p_from) + ". Mode is " + itos((int)config.rpc_mode) + ", authority is " + itos(p_node->get_multiplayer_authority()) + ".");
+	ERR_FAIL_COND_V_MSG(!can_call, nullptr, "RPC '" + String(config.name) + "' is not allowed on node " + p_node->get_path() + " from: " + itos(p_from) + ". Mode is " + itos((int)config.rpc_mode) + ", authority is " + itos(p_node->get_multiplayer_authority()) + ".");
+	// Never erased from the cache, so it stays valid.
+	return &config;
+}
 
-	int argc = 0;
+int SceneRPCInterface::_decode_rpc_argc(const uint8_t *p_packet, int p_packet_len, int &r_offset) {
+	ERR_FAIL_COND_V_MSG(r_offset > p_packet_len, -1, "Invalid packet received. Size too small.");
 
 	const bool byte_only_or_no_args = p_packet[0] & BYTE_ONLY_OR_NO_ARGS_FLAG;
 	if (byte_only_or_no_args) {
-		if (p_offset < p_packet_len) {
-			// This packet contains only bytes.
-			argc = 1;
+		// This packet contains only bytes, if any.
+		return r_offset < p_packet_len ? 1 : 0;
+	}
+	// Normal variant, takes the argument count from the packet.
+	ERR_FAIL_COND_V_MSG(r_offset >= p_packet_len, -1, "Invalid packet received. Size too small.");
+	return p_packet[r_offset++];
+}
+
+Error SceneRPCInterface::_decode_rpc_args(const uint8_t *p_packet, int p_packet_len, int p_offset, Variant *r_args, int p_argc) {
+	const bool allow_objects = multiplayer->is_object_decoding_allowed();
+	if (p_packet[0] & BYTE_ONLY_OR_NO_ARGS_FLAG) {
+		if (p_argc == 1) {
+			PackedByteArray pba;
+			pba.resize(p_packet_len - p_offset);
+			memcpy(pba.ptrw(), &p_packet[p_offset], p_packet_len - p_offset);
+			r_args[0] = pba;
 		}
+		return OK;
+	}
+	for (int i = 0; i < p_argc; i++) {
+		ERR_FAIL_COND_V_MSG(p_offset >= p_packet_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		int vlen;
+		Error err = MultiplayerAPI::decode_and_decompress_variant(r_args[i], &p_packet[p_offset], p_packet_len - p_offset, &vlen, allow_objects);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
+		p_offset += vlen;
+	}
+	return OK;
+}
+
+void SceneRPCInterface::_call_rpc(Node *p_node, const RPCConfig &p_config, const Variant **p_args, int p_argc) {
+	Callable::CallError ce;
+
+	if (p_config.method && !p_node->get_script_instance()) {
+		p_config.method->call(p_node, p_args, p_argc, ce);
 	} else {
-		// Normal variant, takes the argument count from the packet.
-		ERR_FAIL_COND_MSG(p_offset >= p_packet_len, "Invalid packet received. Size too small.");
-		argc = p_packet[p_offset];
-		p_offset += 1;
+		p_node->callp(p_config.name, p_args, p_argc, ce);
+	}
+	if (ce.error != Callable::CallError::CALL_OK) {
+		String error = Variant::get_call_error_text(p_node, p_config.name, p_args, p_argc, ce);
+		error = "RPC - " + error;
+		ERR_PRINT(error);
 	}
+}
 
-	Vector<Variant> args;
-	Vector<const Variant *> argp;
+void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset) {
+	const RPCConfig *config = _get_rpc_config(p_node, p_rpc_method_id, p_from);
+	if (!config) {
+		return;
+	}
+	const int argc = _decode_rpc_argc(p_packet, p_packet_len, p_offset);
+	if (argc < 0) {
+		return;
+	}
+
+	LocalVector<Variant> args;
+	LocalVector<const Variant *> argp;
 	args.resize(argc);
 	argp.resize(argc);
 
@@ -275,20 +413,13 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 	_profile_node_data("rpc_in", p_node->get_instance_id(), p_packet_len);
 #endif
 
-	int out;
-	MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
-	for (int i = 0; i < argc; i++) {
-		argp.write[i] = &args[i];
+	if (_decode_rpc_args(p_packet, p_packet_len, p_offset, args.ptr(), argc) != OK) {
+		return;
 	}
-
-	Callable::CallError ce;
-
-	p_node->callp(config.name, (const Variant **)argp.ptr(), argc, ce);
-	if (ce.error != Callable::CallError::CALL_OK) {
-		String error = Variant::get_call_error_text(p_node, config.name, (const Variant **)argp.ptr(), argc, ce);
-		error = "RPC - " + error;
-		ERR_PRINT(error);
+	for (int i = 0; i < argc; i++) {
+		argp[i] = &args[i];
 	}
+	_call_rpc(p_node, *config, argp.ptr(), argc);
 }
 
 void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, const RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount) {
@@ -423,13 +554,9 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 	// We can now set the meta
 	packet_cache.write[0] = command_type + (node_id_compression << NODE_ID_COMPRESSION_SHIFT) + (name_id_compression << NAME_ID_COMPRESSION_SHIFT) + (byte_only_or_no_args ? BYTE_ONLY_OR_NO_ARGS_FLAG : 0);
 
-	// Take chance and set transfer mode, since all send methods will use it.
-	peer->set_transfer_channel(p_config.channel);
-	peer->set_transfer_mode(p_config.transfer_mode);
-
 	if (has_all_peers) {
 		for (const int P : targets) {
-			multiplayer->send_command(P, packet_cache.ptr(), ofs);
+			_send_packet(P, p_config, packet_cache.ptr(), ofs);
 		}
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
@@ -449,16 +576,105 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				multiplayer->send_command(P, packet_cache.ptr(), ofs);
+				_send_packet(P, p_config, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len);
+				_send_packet(P, p_config, packet_cache.ptr(), ofs + path_len);
 			}
 		}
 	}
 }
 
+void SceneRPCInterface::_send_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len) {
+	RPCBatch *batch = nullptr;
+	if (batching) {
+		for (RPCBatch &E : batches) {
+			if (E.peer == p_to && E.channel == p_config.channel && E.transfer_mode == p_config.transfer_mode) {
+				batch = &E;
+				break;
+			}
+		}
+	}
+
+	if (!batching || p_packet_len + 3 > RPC_BATCH_MAX_SIZE) {
+		if (batch) {
+			_flush_batch(*batch); // Keep the order.
+		}
+		Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+		peer->set_transfer_channel(p_config.channel);
+		peer->set_transfer_mode(p_config.transfer_mode);
+		multiplayer->send_command(p_to, p_packet, p_packet_len);
+		return;
+	}
+
+	if (!batch) {
+		batches.push_back(RPCBatch());
+		batch = &batches[batches.size() - 1];
+		batch->peer = p_to;
+		batch->channel = p_config.channel;
+		batch->transfer_mode = p_config.transfer_mode;
+	} else if (batch->data.size() + 2 + p_packet_len > RPC_BATCH_MAX_SIZE) {
+		_flush_batch(*batch);
+	}
+
+	if (batch->data.is_empty()) {
+		batch->data.push_back(SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL | (NETWORK_NODE_ID_BATCH << NODE_ID_COMPRESSION_SHIFT));
+	}
+	const uint32_t ofs = batch->data.size();
+	batch->data.resize(ofs + 2 + p_packet_len);
+	encode_uint16(p_packet_len, &batch->data[ofs]);
+	memcpy(&batch->data[ofs + 2], p_packet, p_packet_len);
+}
+
+void SceneRPCInterface::_flush_batch(RPCBatch &p_batch) {
+	if (p_batch.data.is_empty()) {
+		return;
+	}
+	if (p_batch.peer <= 0 || multiplayer->has_connected_peer(p_batch.peer)) {
+		Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+		peer->set_transfer_channel(p_batch.channel);
+		peer->set_transfer_mode(p_batch.transfer_mode);
+		multiplayer->send_command(p_batch.peer, p_batch.data.ptr(), p_batch.data.size());
+	}
+	p_batch.data.clear();
+}
+
+void SceneRPCInterface::flush_batches() {
+	for (RPCBatch &E : batches) {
+		_flush_batch(E);
+	}
+}
+
+void SceneRPCInterface::on_peer_change(int p_id, bool p_connected) {
+	if (p_connected) {
+		return;
+	}
+	// Drop what was batched for the peer, so a new peer reusing its ID doesn't get it.
+	for (uint32_t i = 0; i < batches.size();) {
+		if (batches[i].peer == p_id) {
+			batches.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+}
+
+void SceneRPCInterface::clear_batches() {
+	batches.clear();
+}
+
+void SceneRPCInterface::set_batching_enabled(bool p_enabled) {
+	if (batching && !p_enabled) {
+		flush_batches();
+	}
+	batching = p_enabled;
+}
+
+bool SceneRPCInterface::is_batching_enabled() const {
+	return batching;
+}
+
 Error SceneRPCInterface::rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	ERR_FAIL_COND_V_MSG(peer.is_null(), ERR_UNCONFIGURED, "Trying to call an RPC while no multiplayer peer is active.");
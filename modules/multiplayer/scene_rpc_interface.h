@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_api.h"
 
 class SceneMultiplayer;
@@ -48,6 +49,7 @@ private:
 		bool call_local = false;
 		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
 		int channel = 0;
+		MethodBind *method = nullptr; // Native methods only, to skip the lookup when the node has no script.
 
 		bool operator==(RPCConfig const &p_other) const {
 			return name == p_other.name;
@@ -70,6 +72,18 @@ private:
 		NETWORK_NODE_ID_COMPRESSION_8 = 0,
 		NETWORK_NODE_ID_COMPRESSION_16,
 		NETWORK_NODE_ID_COMPRESSION_32,
+		NETWORK_NODE_ID_BATCH, // Not an RPC, but several RPC packets prefixed by their 16 bits size.
+	};
+
+	enum {
+		RPC_BATCH_MAX_SIZE = 1200, // Below the usual MTU, larger RPCs are sent on their own.
+	};
+
+	struct RPCBatch {
+		int peer = 0;
+		int channel = 0;
+		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		LocalVector<uint8_t> data;
 	};
 
 	enum NetworkNameIdCompression {
@@ -85,14 +99,25 @@ private:
 
 	HashMap<ObjectID, RPCConfigCache> rpc_cache;
 
+	bool batching = false;
+	LocalVector<RPCBatch> batches;
+
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_node_data(const String &p_what, ObjectID p_id, int p_size);
 #endif
 
 protected:
 	void _process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
+	bool _decode_rpc_target(int p_from, const uint8_t *p_packet, int p_packet_len, Node *&r_node, uint16_t &r_name_id, int &r_packet_len, int &r_offset);
+	const RPCConfig *_get_rpc_config(Node *p_node, const uint16_t p_rpc_method_id, int p_from);
+	int _decode_rpc_argc(const uint8_t *p_packet, int p_packet_len, int &r_offset);
+	Error _decode_rpc_args(const uint8_t *p_packet, int p_packet_len, int p_offset, Variant *r_args, int p_argc);
+	void _call_rpc(Node *p_node, const RPCConfig &p_config, const Variant **p_args, int p_argc);
 
 	void _send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, const RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount);
+	void _send_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len);
+	void _flush_batch(RPCBatch &p_batch);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len);
 	Node *_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len);
 
 	void _parse_rpc_config(const Variant &p_config, bool p_for_node, RPCConfigCache &r_cache);
@@ -103,6 +128,13 @@ public:
 	void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len);
 	String get_rpc_md5(const Object *p_obj);
 
+	void on_peer_change(int p_id, bool p_connected);
+
+	void set_batching_enabled(bool p_enabled);
+	bool is_batching_enabled() const;
+	void flush_batches();
+	void clear_batches();
+
 	SceneRPCInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache, SceneReplicationInterface *p_replicator) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -35,6 +35,30 @@
 
 #include "../scene_multiplayer.h"
 
+class TestSceneReplicationInterfaceAccessor {
+public:
+	static void add_synchronizer(SceneReplicationInterface *p_replicator, int p_peer, MultiplayerSynchronizer *p_sync) {
+		p_replicator->sync_nodes.insert(p_sync->get_instance_id());
+		p_replicator->peers_info[p_peer].sync_nodes.insert(p_sync->get_instance_id());
+	}
+
+	static LocalVector<ObjectID> get_relevant_synchronizers(SceneReplicationInterface *p_replicator, int p_peer) {
+		p_replicator->_update_interest_grid();
+		LocalVector<ObjectID> synchronizers;
+		p_replicator->_get_relevant_synchronizers(p_replicator->peers_info[p_peer], synchronizers);
+		return synchronizers;
+	}
+
+	static const HashMap<ObjectID, real_t> &get_priorities(SceneReplicationInterface *p_replicator, int p_peer) {
+		return p_replicator->peers_info[p_peer].sync_priorities;
+	}
+
+	// What _send_sync() does for the synchronizers that fit in the budget.
+	static void mark_sent(SceneReplicationInterface *p_replicator, int p_peer, MultiplayerSynchronizer *p_sync) {
+		p_replicator->peers_info[p_peer].sync_priorities[p_sync->get_instance_id()] = 0;
+	}
+};
+
 namespace TestSceneMultiplayer {
 
 static inline Array build_array() {
@@ -65,6 +89,9 @@ TEST_CASE("[Multiplayer][SceneMultiplayer] Defaults") {
 	CHECK(scene_multiplayer->is_server_relay_enabled());
 	CHECK_EQ(scene_multiplayer->get_max_sync_packet_size(), 1350);
 	CHECK_EQ(scene_multiplayer->get_max_delta_packet_size(), 65535);
+	CHECK_EQ(scene_multiplayer->get_max_sync_bytes_per_peer(), 0);
+	CHECK_EQ(scene_multiplayer->get_interest_cell_size(), 64);
+	CHECK_FALSE(scene_multiplayer->is_rpc_batching_enabled());
 	CHECK(scene_multiplayer->is_server());
 }
 
@@ -278,4 +305,421 @@ TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Complete Authentication")
 	}
 }
 
+TEST_CASE("[Multiplayer][SceneMultiplayer] Interest management settings") {
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+
+	scene_multiplayer->set_max_sync_bytes_per_peer(4096);
+	CHECK_EQ(scene_multiplayer->get_max_sync_bytes_per_peer(), 4096);
+	scene_multiplayer->set_interest_cell_size(32);
+	CHECK_EQ(scene_multiplayer->get_interest_cell_size(), 32);
+
+	ERR_PRINT_OFF;
+	scene_multiplayer->set_max_sync_bytes_per_peer(-1);
+	scene_multiplayer->set_interest_cell_size(0);
+	// Not connected.
+	scene_multiplayer->set_peer_interest(42, Vector3(), 100);
+	ERR_PRINT_ON;
+	CHECK_EQ(scene_multiplayer->get_max_sync_bytes_per_peer(), 4096);
+	CHECK_EQ(scene_multiplayer->get_interest_cell_size(), 32);
+
+	MultiplayerSynchronizer *synchronizer = memnew(MultiplayerSynchronizer);
+	CHECK_FALSE(synchronizer->is_spatial_interest_enabled());
+	CHECK_EQ(synchronizer->get_sync_priority(), 1);
+	Vector3 position;
+	CHECK_FALSE(synchronizer->get_interest_position(position));
+	memdelete(synchronizer);
+}
+
+static MultiplayerSynchronizer *_add_interest_body(const Vector2 &p_position, bool p_spatial_interest, real_t p_priority) {
+	Node2D *body = memnew(Node2D);
+	body->set_position(p_position);
+	MultiplayerSynchronizer *sync = memnew(MultiplayerSynchronizer);
+	sync->set_spatial_interest_enabled(p_spatial_interest);
+	sync->set_sync_priority(p_priority);
+	body->add_child(sync);
+	SceneTree::get_singleton()->get_root()->add_child(body);
+	return sync;
+}
+
+TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Relevant synchronizers") {
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+	Ref<SceneReplicationInterface> replicator;
+	replicator.instantiate(scene_multiplayer.ptr(), nullptr);
+	const int peer = 2;
+	replicator->on_peer_change(peer, true);
+	replicator->set_interest_cell_size(32);
+
+	MultiplayerSynchronizer *near = _add_interest_body(Vector2(0, 0), true, 1);
+	MultiplayerSynchronizer *mid = _add_interest_body(Vector2(50, 0), true, 1);
+	MultiplayerSynchronizer *far = _add_interest_body(Vector2(500, 0), true, 1);
+	// Synchronizers without spatial interest are always relevant.
+	MultiplayerSynchronizer *global = _add_interest_body(Vector2(1000, 0), false, 2.5);
+	for (MultiplayerSynchronizer *sync : { near, mid, far, global }) {
+		TestSceneReplicationInterfaceAccessor::add_synchronizer(replicator.ptr(), peer, sync);
+	}
+
+	SUBCASE("Without interest nor budget, all visible synchronizers are relevant") {
+		LocalVector<ObjectID> relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_EQ(relevant.size(), 4u);
+		CHECK(TestSceneReplicationInterfaceAccessor::get_priorities(replicator.ptr(), peer).is_empty());
+	}
+
+	SUBCASE("Interest filters by distance") {
+		// Small areas only visit the grid cells they overlap.
+		replicator->set_peer_interest(peer, Vector3(), 4);
+		LocalVector<ObjectID> relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_EQ(relevant.size(), 2u);
+		CHECK(relevant.has(near->get_instance_id()));
+		CHECK(relevant.has(global->get_instance_id()));
+
+		replicator->set_peer_interest(peer, Vector3(50, 0, 0), 4);
+		relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_EQ(relevant.size(), 2u);
+		CHECK(relevant.has(mid->get_instance_id()));
+		CHECK(relevant.has(global->get_instance_id()));
+
+		// Larger areas go through the populated cells instead.
+		replicator->set_peer_interest(peer, Vector3(), 100);
+		relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_EQ(relevant.size(), 3u);
+		CHECK(relevant.has(near->get_instance_id()));
+		CHECK(relevant.has(mid->get_instance_id()));
+		CHECK(relevant.has(global->get_instance_id()));
+
+		replicator->set_peer_interest(peer, Vector3(450, 0, 0), 100);
+		relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_EQ(relevant.size(), 2u);
+		CHECK(relevant.has(far->get_instance_id()));
+		CHECK(relevant.has(global->get_instance_id()));
+	}
+
+	SUBCASE("The budget sends the highest accumulated priorities first") {
+		replicator->set_peer_interest(peer, Vector3(), 100);
+		replicator->set_max_sync_bytes_per_peer(100);
+		const HashMap<ObjectID, real_t> &priorities = TestSceneReplicationInterfaceAccessor::get_priorities(replicator.ptr(), peer);
+
+		// Relevance is 2 at the origin, down to 1 at the edge of the area.
+		LocalVector<ObjectID> relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		REQUIRE_EQ(relevant.size(), 3u);
+		CHECK_EQ(relevant[0], global->get_instance_id());
+		CHECK_EQ(relevant[1], near->get_instance_id());
+		CHECK_EQ(relevant[2], mid->get_instance_id());
+		CHECK(Math::is_equal_approx(priorities[global->get_instance_id()], 2.5));
+		CHECK(Math::is_equal_approx(priorities[near->get_instance_id()], 2));
+		CHECK(Math::is_equal_approx(priorities[mid->get_instance_id()], 1.5));
+		CHECK_FALSE(priorities.has(far->get_instance_id()));
+
+		// Priorities accumulate until a synchronizer is sent.
+		TestSceneReplicationInterfaceAccessor::mark_sent(replicator.ptr(), peer, global);
+		relevant = TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		REQUIRE_EQ(relevant.size(), 3u);
+		CHECK_EQ(relevant[0], near->get_instance_id());
+		CHECK_EQ(relevant[1], mid->get_instance_id());
+		CHECK_EQ(relevant[2], global->get_instance_id());
+		CHECK(Math::is_equal_approx(priorities[near->get_instance_id()], 4));
+		CHECK(Math::is_equal_approx(priorities[mid->get_instance_id()], 3));
+		CHECK(Math::is_equal_approx(priorities[global->get_instance_id()], 2.5));
+
+		// Leaving the area of interest resets the priority.
+		replicator->set_peer_interest(peer, Vector3(450, 0, 0), 100);
+		TestSceneReplicationInterfaceAccessor::get_relevant_synchronizers(replicator.ptr(), peer);
+		CHECK_FALSE(priorities.has(near->get_instance_id()));
+		CHECK(Math::is_equal_approx(priorities[far->get_instance_id()], 1.5));
+	}
+
+	replicator->on_peer_change(peer, false);
+	for (MultiplayerSynchronizer *sync : { near, mid, far, global }) {
+		memdelete(sync->get_parent());
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationConfig] Quantized state encoding") {
+	Ref<SceneReplicationConfig> config;
+	config.instantiate();
+	config->add_property(NodePath(":position"));
+	config->add_property(NodePath(":quaternion"));
+	config->add_property(NodePath(":health"));
+	config->add_property(NodePath(":name"));
+	config->property_set_quantization_bits(NodePath(":position"), 16);
+	config->property_set_quantization_range(NodePath(":position"), Vector2(-1024, 1024));
+	config->property_set_quantization_bits(NodePath(":quaternion"), 10);
+	config->property_set_quantization_bits(NodePath(":health"), 7);
+	config->property_set_quantization_range(NodePath(":health"), Vector2(0, 100));
+
+	const Vector<SceneReplicationConfig::PropertyQuantization> &quantization = config->get_sync_quantization();
+	REQUIRE_EQ(quantization.size(), 4);
+	CHECK_EQ(quantization[0].bits, 16);
+	CHECK_EQ(quantization[3].bits, 0);
+
+	const Quaternion rotation(Vector3(0.3, 1, -0.2).normalized(), 2.1);
+	Variant state[4] = { Vector3(100.3, -512.7, 3), rotation, 73.4, "Player" };
+	const Variant *state_ptrs[4] = { &state[0], &state[1], &state[2], &state[3] };
+
+	int size = 0;
+	REQUIRE_EQ(MultiplayerSynchronizer::encode_state(state_ptrs, 4, quantization.ptr(), nullptr, size), OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(size);
+	REQUIRE_EQ(MultiplayerSynchronizer::encode_state(state_ptrs, 4, quantization.ptr(), buffer.ptrw(), size), OK);
+
+	// Compare against sending every value as is.
+	int raw_size = 0;
+	REQUIRE_EQ(MultiplayerAPI::encode_and_compress_variants(state_ptrs, 4, nullptr, raw_size), OK);
+	CHECK_LT(size * 2, raw_size);
+
+	Vector<Variant> decoded;
+	decoded.resize(4);
+	int consumed = 0;
+	REQUIRE_EQ(MultiplayerSynchronizer::decode_state(decoded, quantization.ptr(), buffer.ptr(), buffer.size(), consumed), OK);
+	CHECK_EQ(consumed, size);
+	CHECK_LT(Vector3(decoded[0]).distance_to(state[0]), 0.05);
+	CHECK_GT(Math::abs(Quaternion(decoded[1]).dot(rotation)), 0.999);
+	CHECK_LT(Math::abs(double(decoded[2]) - 73.4), 0.5);
+	CHECK_EQ(decoded[3], state[3]);
+
+	ERR_PRINT_OFF;
+	for (int i = 0; i < size; i++) {
+		Vector<Variant> truncated;
+		truncated.resize(4);
+		CHECK_NE(MultiplayerSynchronizer::decode_state(truncated, quantization.ptr(), buffer.ptr(), i, consumed), OK);
+	}
+	ERR_PRINT_ON;
+
+	// Without quantization, the encoding is unchanged.
+	config->property_set_quantization_bits(NodePath(":position"), 0);
+	config->property_set_quantization_bits(NodePath(":quaternion"), 0);
+	config->property_set_quantization_bits(NodePath(":health"), 0);
+	REQUIRE_EQ(MultiplayerSynchronizer::encode_state(state_ptrs, 4, config->get_sync_quantization().ptr(), nullptr, size), OK);
+	CHECK_EQ(size, raw_size);
+}
+
+// Records sent packets, and delivers the ones pushed back as if they came from a remote peer.
+class _TestLoopbackPeer : public OfflineMultiplayerPeer {
+	GDCLASS(_TestLoopbackPeer, OfflineMultiplayerPeer);
+
+public:
+	struct Packet {
+		int peer = 0;
+		Vector<uint8_t> data;
+	};
+
+	int target_peer = 0;
+	List<Packet> sent;
+	List<Packet> incoming;
+	Packet current;
+
+	virtual int get_available_packet_count() const override { return incoming.size(); }
+	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override {
+		ERR_FAIL_COND_V(incoming.is_empty(), ERR_UNAVAILABLE);
+		current = incoming.front()->get();
+		incoming.pop_front();
+		*r_buffer = current.data.ptr();
+		r_buffer_size = current.data.size();
+		return OK;
+	}
+	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override {
+		Packet packet;
+		packet.peer = target_peer;
+		packet.data.resize(p_buffer_size);
+		memcpy(packet.data.ptrw(), p_buffer, p_buffer_size);
+		sent.push_back(packet);
+		return OK;
+	}
+	virtual void set_target_peer(int p_peer_id) override { target_peer = p_peer_id; }
+	virtual int get_packet_peer() const override { return incoming.is_empty() ? 0 : incoming.front()->get().peer; }
+
+	// Remote call command with the batch node ID compression.
+	static constexpr uint8_t BATCH_HEADER = SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL | (3 << SceneMultiplayer::CMD_FLAG_0_SHIFT);
+
+	int take_batches(List<Packet> *r_batches = nullptr) {
+		int count = 0;
+		for (const Packet &packet : sent) {
+			if (!packet.data.is_empty() && packet.data[0] == BATCH_HEADER) {
+				if (r_batches) {
+					r_batches->push_back(packet);
+				}
+				count++;
+			}
+		}
+		sent.clear();
+		return count;
+	}
+};
+
+TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] RPC batching") {
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+	Ref<_TestLoopbackPeer> peer;
+	peer.instantiate();
+	scene_multiplayer->set_multiplayer_peer(peer);
+	SceneTree::get_singleton()->set_multiplayer(scene_multiplayer);
+	scene_multiplayer->set_rpc_batching_enabled(true);
+
+	const int remote_id = 2;
+	peer->emit_signal(SNAME("peer_connected"), remote_id);
+	REQUIRE(scene_multiplayer->get_peer_ids().has(remote_id));
+
+	// Native methods without a script are dispatched through their cached MethodBind.
+	Node *node = memnew(Node);
+	node->set_name("RPCTarget");
+	Dictionary rpc_config;
+	rpc_config["rpc_mode"] = MultiplayerAPI::RPC_MODE_ANY_PEER;
+	node->rpc_config("set_editor_description", rpc_config);
+	node->rpc_config("set_process_priority", rpc_config);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	SUBCASE("Batched RPCs round-trip") {
+		CHECK_EQ(node->rpc_id(remote_id, "set_editor_description", "Batched"), OK);
+		CHECK_EQ(node->rpc_id(remote_id, "set_process_priority", 7), OK);
+		CHECK_MESSAGE(peer->take_batches() == 0, "RPCs should wait for the next poll.");
+
+		CHECK_EQ(scene_multiplayer->poll(), OK);
+		List<_TestLoopbackPeer::Packet> batches;
+		REQUIRE_EQ(peer->take_batches(&batches), 1);
+		CHECK_EQ(batches.front()->get().peer, remote_id);
+
+		// Deliver the batch back, as if the remote peer sent it.
+		peer->incoming.push_back(batches.front()->get());
+		CHECK_EQ(scene_multiplayer->poll(), OK);
+		CHECK_EQ(node->get_editor_description(), "Batched");
+		CHECK_EQ(node->get_process_priority(), 7);
+	}
+
+	SUBCASE("Batches are dropped when their peer disconnects") {
+		CHECK_EQ(node->rpc_id(remote_id, "set_process_priority", 7), OK);
+		peer->emit_signal(SNAME("peer_disconnected"), remote_id);
+		// A new peer reusing the ID must not get RPCs meant for the previous one.
+		peer->emit_signal(SNAME("peer_connected"), remote_id);
+		CHECK_EQ(scene_multiplayer->poll(), OK);
+		CHECK_EQ(peer->take_batches(), 0);
+	}
+
+	memdelete(node);
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][Multiplayer][SceneMultiplayer][SceneTree] RPC loopback with and without batching") {
+	Ref<SceneMultiplayer> scene_multiplayer;
+	scene_multiplayer.instantiate();
+	Ref<_TestLoopbackPeer> peer;
+	peer.instantiate();
+	scene_multiplayer->set_multiplayer_peer(peer);
+	SceneTree::get_singleton()->set_multiplayer(scene_multiplayer);
+
+	const int remote_id = 2;
+	peer->emit_signal(SNAME("peer_connected"), remote_id);
+
+	Node *node = memnew(Node);
+	node->set_name("RPCTarget");
+	Dictionary rpc_config;
+	rpc_config["rpc_mode"] = MultiplayerAPI::RPC_MODE_ANY_PEER;
+	node->rpc_config("set_process_priority", rpc_config);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	// Like 64 inputs per tick, each sent back as if a remote peer sent it.
+	const int ticks = 2000;
+	const int rpcs_per_tick = 64;
+	uint64_t usec[2] = {};
+	for (int batching = 0; batching < 2; batching++) {
+		scene_multiplayer->set_rpc_batching_enabled(batching);
+		const uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int tick = 0; tick < ticks; tick++) {
+			for (int i = 0; i < rpcs_per_tick; i++) {
+				node->rpc_id(remote_id, "set_process_priority", i);
+			}
+			scene_multiplayer->poll(); // Sends the batches.
+			for (const _TestLoopbackPeer::Packet &packet : peer->sent) {
+				if ((packet.data[0] & SceneMultiplayer::CMD_MASK) == SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL) {
+					peer->incoming.push_back(packet);
+				}
+			}
+			peer->sent.clear();
+			scene_multiplayer->poll();
+		}
+		usec[batching] = OS::get_singleton()->get_ticks_usec() - start;
+		CHECK_EQ(node->get_process_priority(), rpcs_per_tick - 1);
+		node->set_process_priority(0);
+	}
+	print_line(vformat("%d ticks of %d RPCs sent and received: separate packets %d ms, batched %d ms.", ticks, rpcs_per_tick, usec[0] / 1000, usec[1] / 1000));
+
+	memdelete(node);
+}
+
+static Node2D *rollback_body = nullptr;
+
+static void rollback_step(int64_t p_tick, const Variant &p_input) {
+	rollback_body->set_position(rollback_body->get_position() + Vector2(p_input));
+}
+
+TEST_CASE("[Multiplayer][MultiplayerSynchronizer][SceneTree] Rollback and resimulation") {
+	Ref<SceneReplicationConfig> config;
+	config.instantiate();
+	config->add_property(NodePath(":position"));
+
+	// Two local peers simulating the same body: the server is authoritative, the client predicts.
+	Node2D *server_body = memnew(Node2D);
+	Node2D *client_body = memnew(Node2D);
+	MultiplayerSynchronizer *server_sync = memnew(MultiplayerSynchronizer);
+	MultiplayerSynchronizer *client_sync = memnew(MultiplayerSynchronizer);
+	server_sync->set_replication_config(config);
+	server_sync->set_rollback_history(16);
+	server_body->add_child(server_sync);
+	client_sync->set_replication_config(config);
+	client_sync->set_rollback_history(16);
+	client_body->add_child(client_sync);
+	SceneTree::get_singleton()->get_root()->add_child(server_body);
+	SceneTree::get_singleton()->get_root()->add_child(client_body);
+
+	const Vector2 input(1, 0);
+	for (int64_t tick = 1; tick <= 8; tick++) {
+		client_sync->set_input(tick, input);
+		client_body->set_position(client_body->get_position() + input);
+		CHECK_EQ(client_sync->record_state(tick), OK);
+		// The server body gets pushed at tick 3, which the client mispredicts.
+		server_body->set_position(server_body->get_position() + (tick == 3 ? Vector2(-2, 5) : input));
+		CHECK_EQ(server_sync->record_state(tick), OK);
+	}
+	CHECK_EQ(client_body->get_position(), Vector2(8, 0));
+	CHECK_EQ(server_body->get_position(), Vector2(5, 5));
+
+	CHECK_EQ(server_sync->restore_state(3), OK);
+	const Vector2 authoritative = server_body->get_position();
+	CHECK_EQ(authoritative, Vector2(0, 5));
+	CHECK_EQ(server_sync->restore_state(8), OK);
+
+	// The authoritative state of tick 3 reaches the client, which replays its inputs.
+	client_body->set_position(authoritative);
+	CHECK_EQ(client_sync->record_state(3), OK);
+	rollback_body = client_body;
+	client_sync->connect(SNAME("resimulate_tick"), callable_mp_static(rollback_step));
+	CHECK_EQ(client_sync->resimulate(3, 8), OK);
+	CHECK_EQ(client_body->get_position(), server_body->get_position());
+	CHECK(client_sync->has_state(8));
+	CHECK_EQ(client_sync->get_input(8), Variant(input));
+
+	CHECK_EQ(client_sync->restore_state(5), OK);
+	CHECK_EQ(client_body->get_position(), Vector2(2, 5));
+
+	CHECK_FALSE(client_sync->has_state(0));
+	ERR_PRINT_OFF;
+	CHECK_EQ(client_sync->resimulate(0, 20), ERR_INVALID_PARAMETER);
+	CHECK_EQ(client_sync->restore_state(42), ERR_DOES_NOT_EXIST);
+	ERR_PRINT_ON;
+
+	// States recorded with a previous property list are dropped.
+	config->add_property(NodePath(":rotation"));
+	ERR_PRINT_OFF;
+	CHECK_EQ(client_sync->restore_state(8), ERR_DOES_NOT_EXIST);
+	ERR_PRINT_ON;
+	client_body->set_rotation(1);
+	CHECK_EQ(client_sync->record_state(9), OK);
+	client_body->set_rotation(0);
+	CHECK_EQ(client_sync->restore_state(9), OK);
+	CHECK_EQ(client_body->get_rotation(), 1);
+
+	rollback_body = nullptr;
+	memdelete(server_body);
+	memdelete(client_body);
+}
+
 } // namespace TestSceneMultiplayer
@@ -45,9 +45,19 @@ private:
 	int _write_pos = 0;
 	int _read_pos = 0;
 	RingBuffer<uint8_t> _payload;
+	int _borrowed = 0; // Payload of the last packet read in place, kept until released.
 
 public:
+	// Frees the payload of the last packet returned by read_packet_direct, invalidating it.
+	void release_borrowed() {
+		if (_borrowed) {
+			_payload.advance_read(_borrowed);
+			_borrowed = 0;
+		}
+	}
+
 	Error write_packet(const uint8_t *p_payload, uint32_t p_size, const T *p_info) {
+		release_borrowed();
 		ERR_FAIL_COND_V_MSG(p_payload && (uint32_t)_payload.space_left() < p_size, ERR_OUT_OF_MEMORY, "Buffer payload full! Dropping data.");
 		ERR_FAIL_COND_V_MSG(p_info && _queued >= _packets.size(), ERR_OUT_OF_MEMORY, "Too many packets in queue! Dropping data.");
 
@@ -74,6 +84,7 @@ public:
 	}
 
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
+		release_borrowed();
 		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
 		_Packet p = _packets[_read_pos];
 		_read_pos += 1;
@@ -91,7 +102,32 @@ public:
 		return OK;
 	}
 
+	// Like read_packet, but points r_payload to the ring buffer when the payload does not wrap around,
+	// only copying it to p_fallback otherwise. The payload stays valid until the buffer is modified or release_borrowed is called.
+	Error read_packet_direct(const uint8_t **r_payload, uint8_t *p_fallback, int p_bytes, T *r_info, int &r_read) {
+		release_borrowed();
+		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
+		const _Packet &p = _packets[_read_pos];
+		const uint8_t *direct = _payload.get_read_ptr(p.size);
+		if (!direct) {
+			*r_payload = p_fallback;
+			return read_packet(p_fallback, p_bytes, r_info, r_read);
+		}
+		_read_pos += 1;
+		if (_read_pos >= _packets.size()) {
+			_read_pos = 0;
+		}
+		_queued -= 1;
+
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		*r_payload = direct;
+		_borrowed = p.size;
+		return OK;
+	}
+
 	void resize(int p_buf_shift, int p_max_packets) {
+		release_borrowed();
 		_payload.resize(p_buf_shift);
 		_packets.resize(p_max_packets);
 		_read_pos = 0;
@@ -112,6 +148,7 @@ public:
 	}
 
 	void clear() {
+		_borrowed = 0;
 		_payload.resize(0);
 		_packets.resize(0);
 		_read_pos = 0;
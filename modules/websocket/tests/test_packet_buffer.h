@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*  test_packet_buffer.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../packet_buffer.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPacketBuffer {
+
+static void write_sequence(PacketBuffer<int> &r_buffer, int p_size, int p_info) {
+	uint8_t payload[16];
+	for (int i = 0; i < p_size; i++) {
+		payload[i] = p_info + i;
+	}
+	REQUIRE(r_buffer.write_packet(payload, p_size, &p_info) == OK);
+}
+
+static void check_sequence(const uint8_t *p_payload, int p_size, int p_info) {
+	for (int i = 0; i < p_size; i++) {
+		CHECK(p_payload[i] == (uint8_t)(p_info + i));
+	}
+}
+
+TEST_CASE("[WebSocket][PacketBuffer] Direct reads") {
+	PacketBuffer<int> buffer;
+	buffer.resize(4, 8); // 15 usable payload bytes.
+	uint8_t fallback[16];
+	const uint8_t *payload = nullptr;
+	int info = 0;
+	int read = 0;
+
+	SUBCASE("Contiguous payload is read in place") {
+		write_sequence(buffer, 6, 10);
+		REQUIRE(buffer.read_packet_direct(&payload, fallback, sizeof(fallback), &info, read) == OK);
+		CHECK(payload != fallback);
+		CHECK(read == 6);
+		CHECK(info == 10);
+		check_sequence(payload, read, info);
+		// The payload is kept until released.
+		CHECK(buffer.payload_space_left() == 9);
+		buffer.release_borrowed();
+		CHECK(buffer.payload_space_left() == 15);
+	}
+
+	SUBCASE("Wrapped payload is copied to the fallback") {
+		write_sequence(buffer, 12, 10);
+		REQUIRE(buffer.read_packet_direct(&payload, fallback, sizeof(fallback), &info, read) == OK);
+		CHECK(payload != fallback);
+		write_sequence(buffer, 8, 30); // Releases the previous packet, then wraps around.
+		REQUIRE(buffer.read_packet_direct(&payload, fallback, sizeof(fallback), &info, read) == OK);
+		CHECK(payload == fallback);
+		CHECK(read == 8);
+		CHECK(info == 30);
+		check_sequence(payload, read, info);
+		CHECK(buffer.payload_space_left() == 15);
+		CHECK(buffer.packets_left() == 0);
+	}
+
+	SUBCASE("Full buffer is freed by releasing the borrowed payload") {
+		write_sequence(buffer, 15, 10);
+		CHECK(buffer.payload_space_left() == 0);
+		REQUIRE(buffer.read_packet_direct(&payload, fallback, sizeof(fallback), &info, read) == OK);
+		CHECK(payload != fallback);
+		CHECK(read == 15);
+		check_sequence(payload, read, info);
+		CHECK(buffer.payload_space_left() == 0);
+		buffer.release_borrowed();
+		CHECK(buffer.payload_space_left() == 15);
+		write_sequence(buffer, 4, 50);
+		REQUIRE(buffer.read_packet_direct(&payload, fallback, sizeof(fallback), &info, read) == OK);
+		CHECK(read == 4);
+		CHECK(info == 50);
+		check_sequence(payload, read, info);
+	}
+}
+
+TEST_CASE("[WebSocket][PacketBuffer] RingBuffer read pointer") {
+	RingBuffer<uint8_t> ring(3); // 7 usable bytes.
+	const uint8_t data[] = { 1, 2, 3, 4, 5 };
+	CHECK(ring.get_read_ptr(1) == nullptr);
+
+	REQUIRE(ring.write(data, 5) == 5);
+	const uint8_t *ptr = ring.get_read_ptr(5);
+	REQUIRE(ptr != nullptr);
+	CHECK(memcmp(ptr, data, 5) == 0);
+	CHECK(ring.get_read_ptr(6) == nullptr);
+
+	CHECK(ring.advance_read(4) == 4);
+	REQUIRE(ring.write(data, 5) == 5); // Wraps around.
+	CHECK(ring.data_left() == 6);
+	ptr = ring.get_read_ptr(4);
+	REQUIRE(ptr != nullptr);
+	CHECK(ptr[0] == 5);
+	CHECK(memcmp(ptr + 1, data, 3) == 0);
+	CHECK(ring.get_read_ptr(5) == nullptr);
+}
+
+} // namespace TestPacketBuffer
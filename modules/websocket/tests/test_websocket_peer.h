@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_websocket_peer.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "../websocket_peer.h"
+
+#include "core/io/stream_peer_tcp.h"
+#include "core/io/tcp_server.h"
+#include "tests/test_macros.h"
+
+namespace TestWebSocketPeer {
+
+const IPAddress LOCALHOST("127.0.0.1");
+const uint64_t MAX_WAIT_USEC = 2000000;
+
+// Polls both peers until they are open, or the wait times out.
+static bool open_pair(Ref<TCPServer> &r_server, Ref<WebSocketPeer> &r_client, Ref<WebSocketPeer> &r_server_peer) {
+	r_server.instantiate();
+	if (r_server->listen(0, LOCALHOST) != OK) {
+		return false;
+	}
+	r_client = Ref<WebSocketPeer>(WebSocketPeer::create());
+	r_server_peer = Ref<WebSocketPeer>(WebSocketPeer::create());
+	if (r_client->connect_to_url(vformat("ws://127.0.0.1:%d", r_server->get_local_port())) != OK) {
+		return false;
+	}
+	bool accepted = false;
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	while (OS::get_singleton()->get_ticks_usec() - start < MAX_WAIT_USEC) {
+		if (!accepted && r_server->is_connection_available()) {
+			accepted = r_server_peer->accept_stream(r_server->take_connection()) == OK;
+		}
+		r_client->poll();
+		if (accepted) {
+			r_server_peer->poll();
+		}
+		if (r_client->get_ready_state() == WebSocketPeer::STATE_OPEN && accepted && r_server_peer->get_ready_state() == WebSocketPeer::STATE_OPEN) {
+			return true;
+		}
+		OS::get_singleton()->delay_usec(100);
+	}
+	return false;
+}
+
+// Sends the packets in rounds that fit the default queues, and returns the time until all of them were received.
+static uint64_t _benchmark_transfer(const Ref<WebSocketPeer> &p_from, const Ref<WebSocketPeer> &p_to, int p_size, int p_count, int &r_received) {
+	const int round_size = MIN(16, (64 * 1024 - 1) / p_size);
+	Vector<uint8_t> payload;
+	payload.resize(p_size);
+	uint8_t *w = payload.ptrw();
+	for (int i = 0; i < p_size; i++) {
+		w[i] = i * 7;
+	}
+	r_received = 0;
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	int sent = 0;
+	while (sent < p_count) {
+		const int count = MIN(round_size, p_count - sent);
+		for (int i = 0; i < count; i++) {
+			if (p_from->put_packet(payload.ptr(), p_size) != OK) {
+				return 0;
+			}
+		}
+		sent += count;
+		const uint64_t round_start = OS::get_singleton()->get_ticks_usec();
+		while (r_received < sent && OS::get_singleton()->get_ticks_usec() - round_start < MAX_WAIT_USEC) {
+			p_from->poll();
+			p_to->poll();
+			while (p_to->get_available_packet_count() > 0) {
+				const uint8_t *packet = nullptr;
+				int packet_size = 0;
+				if (p_to->get_packet(&packet, packet_size) == OK && packet_size == p_size) {
+					r_received++;
+				}
+			}
+		}
+		if (r_received < sent) {
+			return 0;
+		}
+	}
+	return OS::get_singleton()->get_ticks_usec() - start;
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][WebSocket] Local client/server message throughput") {
+	Ref<TCPServer> server;
+	Ref<WebSocketPeer> client;
+	Ref<WebSocketPeer> server_peer;
+	REQUIRE(open_pair(server, client, server_peer));
+
+	const int sizes[] = { 64, 1024, 16384 };
+	for (int size : sizes) {
+		const int count = 64 * 1024 * 1024 / size / 4; // 16 MiB per direction.
+		int received = 0;
+		// Client frames are masked, server frames are not.
+		const uint64_t masked = _benchmark_transfer(client, server_peer, size, count, received);
+		CHECK(received == count);
+		const uint64_t unmasked = _benchmark_transfer(server_peer, client, size, count, received);
+		CHECK(received == count);
+		print_line(vformat("%d messages of %d bytes: client to server (masked) %d ms, server to client %d ms.", count, size, masked / 1000, unmasked / 1000));
+	}
+
+	client->close();
+	server_peer->close();
+	server->stop();
+}
+
+} // namespace TestWebSocketPeer
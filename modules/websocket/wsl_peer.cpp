@@ -570,6 +570,8 @@ ssize_t WSLPeer::_wsl_recv_callback(wslay_event_context_ptr ctx, uint8_t *data,
 		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
 		return -1;
 	}
+	// The last packet returned by get_packet is no longer in use, don't count it as used space.
+	peer->in_buffer.release_borrowed();
 	// Make sure we don't read more than what our buffer can hold.
 	size_t buffer_limit = MIN(peer->in_buffer.payload_space_left(), peer->in_buffer.packets_space_left() * 2); // The minimum size of a websocket message is 2 bytes.
 	size_t to_read = MIN(len, buffer_limit);
@@ -700,6 +702,9 @@ void WSLPeer::poll() {
 		return;
 	}
 
+	// Packets returned by get_packet are only valid until the next poll.
+	in_buffer.release_borrowed();
+
 	if (ready_state == STATE_CONNECTING) {
 		if (is_server) {
 			_do_server_handshake();
@@ -814,11 +819,10 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 		return ERR_UNAVAILABLE;
 	}
 
+	// Avoid copying the packet out of the ring buffer unless it wraps around.
 	int read = 0;
-	uint8_t *rw = packet_buffer.ptrw();
-	in_buffer.read_packet(rw, packet_buffer.size(), &was_string, read);
+	in_buffer.read_packet_direct(r_buffer, packet_buffer.ptrw(), packet_buffer.size(), &was_string, read);
 
-	*r_buffer = rw;
 	r_buffer_size = read;
 
 	return OK;
@@ -445,6 +445,12 @@ void CanvasItem::queue_redraw() {
 
 	pending_update = true;
 
+	if (get_tree()->is_rendering_updates_disabled()) {
+		// Kept pending until updates are enabled again.
+		get_tree()->defer_redraw(callable_mp(this, &CanvasItem::_redraw_callback));
+		return;
+	}
+
 	callable_mp(this, &CanvasItem::_redraw_callback).call_deferred();
 }
 
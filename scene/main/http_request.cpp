@@ -30,12 +30,134 @@
 
 #include "http_request.h"
 
+#include "core/config/project_settings.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::pool_mutex;
+HashMap<String, HTTPRequest::ConnectionPool> HTTPRequest::connection_pool;
+
 Error HTTPRequest::_request() {
+	if (use_connection_pool) {
+		Error err = _acquire_pooled_client();
+		if (err != OK || waiting_for_connection || reused_connection) {
+			// Waiting for a free slot, or already connected.
+			return err;
+		}
+	}
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+String HTTPRequest::_get_pool_key() const {
+	// Connections can only be shared by requests that would have opened the same connection.
+	String key;
+	if (use_tls) {
+		Ref<X509Certificate> ca_chain = tls_options->get_trusted_ca_chain();
+		key = vformat("https://%s:%d|%s:%d|%d|%s|%d", url, port, https_proxy_host, https_proxy_port, tls_options->is_unsafe_client(), tls_options->get_common_name_override(), ca_chain.is_valid() ? (uint64_t)ca_chain->get_instance_id() : 0);
+	} else {
+		key = vformat("http://%s:%d|%s:%d", url, port, http_proxy_host, http_proxy_port);
+	}
+	return key;
+}
+
+void HTTPRequest::_set_client(const Ref<HTTPClient> &p_client) {
+	MutexLock lock(client_mutex);
+	client = p_client;
+}
+
+bool HTTPRequest::_is_method_idempotent() const {
+	switch (method) {
+		case HTTPClient::METHOD_GET:
+		case HTTPClient::METHOD_HEAD:
+		case HTTPClient::METHOD_PUT:
+		case HTTPClient::METHOD_DELETE:
+		case HTTPClient::METHOD_OPTIONS:
+		case HTTPClient::METHOD_TRACE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+Error HTTPRequest::_acquire_pooled_client() {
+	const String key = _get_pool_key();
+	const int max_connections = GLOBAL_GET("network/limits/http_request/max_connections_per_host");
+
+	MutexLock lock(pool_mutex);
+	ConnectionPool &pool = connection_pool[key];
+	while (!pool.idle.is_empty()) {
+		Ref<HTTPClient> idle = pool.idle[pool.idle.size() - 1];
+		pool.idle.remove_at(pool.idle.size() - 1);
+		// The server might have closed the connection while it was idle.
+		if (idle->poll() == OK && idle->get_status() == HTTPClient::STATUS_CONNECTED) {
+			_set_client(idle);
+			client->set_blocking_mode(use_threads.is_set());
+			client->set_read_chunk_size(default_client->get_read_chunk_size());
+			pool_key = key;
+			reused_connection = true;
+			waiting_for_connection = false;
+			return OK;
+		}
+		idle->close();
+		pool.open--;
+	}
+
+	if (max_connections > 0 && pool.open >= max_connections) {
+		// Try again on the next update, when another request might have released its connection.
+		waiting_for_connection = true;
+		return OK;
+	}
+
+	pool.open++;
+	_set_client(Ref<HTTPClient>(HTTPClient::create()));
+	client->set_blocking_mode(use_threads.is_set());
+	client->set_read_chunk_size(default_client->get_read_chunk_size());
+	client->set_http_proxy(http_proxy_host, http_proxy_port);
+	client->set_https_proxy(https_proxy_host, https_proxy_port);
+	pool_key = key;
+	reused_connection = false;
+	waiting_for_connection = false;
+	return OK;
+}
+
+void HTTPRequest::_release_client(bool p_keep_alive) {
+	if (pool_key.is_empty()) {
+		client->close();
+		return;
+	}
+
+	{
+		MutexLock lock(pool_mutex);
+		ConnectionPool *pool = connection_pool.getptr(pool_key);
+		if (pool && p_keep_alive && client->get_status() == HTTPClient::STATUS_CONNECTED && client->is_response_keep_alive()) {
+			// The response was fully read, the connection can be used by the next request.
+			pool->idle.push_back(client);
+		} else {
+			client->close();
+			if (pool) {
+				pool->open--;
+				if (pool->open <= 0 && pool->idle.is_empty()) {
+					connection_pool.erase(pool_key);
+				}
+			}
+		}
+	}
+
+	_set_client(default_client);
+	pool_key = String();
+	reused_connection = false;
+}
+
+bool HTTPRequest::_retry_pooled_connection() {
+	if (!reused_connection || got_response || !_is_method_idempotent()) {
+		return false;
+	}
+	// The server closed the idle connection before answering, try again with another one.
+	// Only safe when repeating the request has no further effect, as the server might have processed it.
+	_release_client(false);
+	request_sent = false;
+	return _request() == OK;
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -183,6 +305,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_stop_request(false);
+}
+
+void HTTPRequest::_stop_request(bool p_keep_alive) {
 	timer->stop();
 
 	if (!requesting) {
@@ -200,7 +326,8 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	_release_client(p_keep_alive);
+	waiting_for_connection = false;
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -247,7 +374,7 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 
 		if (!new_request.is_empty()) {
 			// Process redirect.
-			client->close();
+			_release_client(false);
 			int new_redirs = redirections + 1; // Because _request() will clear it.
 			Error err;
 			if (new_request.begins_with("http")) {
@@ -289,8 +416,19 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 }
 
 bool HTTPRequest::_update_connection() {
+	if (waiting_for_connection) {
+		if (_request() != OK) {
+			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
+			return true;
+		}
+		return false;
+	}
+
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_pooled_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -442,6 +580,8 @@ bool HTTPRequest::_update_connection() {
 						_defer_done(RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PackedByteArray());
 						return true;
 					}
+				} else if (stream_body) {
+					callable_mp(this, &HTTPRequest::_body_chunk_received).call_deferred(chunk);
 				} else {
 					body.append_array(chunk);
 				}
@@ -462,6 +602,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_pooled_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -479,11 +622,15 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	_stop_request(p_status == RESULT_SUCCESS);
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
 }
 
+void HTTPRequest::_body_chunk_received(const PackedByteArray &p_chunk) {
+	emit_signal(SNAME("body_chunk_received"), p_chunk);
+}
+
 void HTTPRequest::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_INTERNAL_PROCESS: {
@@ -523,6 +670,26 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_use_connection_pool(bool p_enable) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+
+	use_connection_pool = p_enable;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
+void HTTPRequest::set_stream_body(bool p_enable) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+
+	stream_body = p_enable;
+}
+
+bool HTTPRequest::is_streaming_body() const {
+	return stream_body;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -546,14 +713,15 @@ String HTTPRequest::get_download_file() const {
 void HTTPRequest::set_download_chunk_size(int p_chunk_size) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
-	client->set_read_chunk_size(p_chunk_size);
+	default_client->set_read_chunk_size(p_chunk_size);
 }
 
 int HTTPRequest::get_download_chunk_size() const {
-	return client->get_read_chunk_size();
+	return default_client->get_read_chunk_size();
 }
 
 HTTPClient::Status HTTPRequest::get_http_client_status() const {
+	MutexLock lock(client_mutex);
 	return client->get_status();
 }
 
@@ -574,11 +742,15 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
-	client->set_http_proxy(p_host, p_port);
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
+	default_client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
-	client->set_https_proxy(p_host, p_port);
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
+	default_client->set_https_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_timeout(double p_timeout) {
@@ -600,6 +772,16 @@ void HTTPRequest::set_tls_options(const Ref<TLSOptions> &p_options) {
 	tls_options = p_options;
 }
 
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(pool_mutex);
+	for (KeyValue<String, ConnectionPool> &E : connection_pool) {
+		for (Ref<HTTPClient> &idle : E.value.idle) {
+			idle->close();
+		}
+	}
+	connection_pool.clear();
+}
+
 void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("request", "url", "custom_headers", "method", "request_data"), &HTTPRequest::request, DEFVAL(PackedStringArray()), DEFVAL(HTTPClient::METHOD_GET), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("request_raw", "url", "custom_headers", "method", "request_data_raw"), &HTTPRequest::request_raw, DEFVAL(PackedStringArray()), DEFVAL(HTTPClient::METHOD_GET), DEFVAL(PackedByteArray()));
@@ -614,6 +796,12 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
+	ClassDB::bind_method(D_METHOD("set_stream_body", "enable"), &HTTPRequest::set_stream_body);
+	ClassDB::bind_method(D_METHOD("is_streaming_body"), &HTTPRequest::is_streaming_body);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -639,10 +827,13 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "stream_body"), "set_stream_body", "is_streaming_body");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
 
+	ADD_SIGNAL(MethodInfo("body_chunk_received", PropertyInfo(Variant::PACKED_BYTE_ARRAY, "chunk")));
 	ADD_SIGNAL(MethodInfo("request_completed", PropertyInfo(Variant::INT, "result"), PropertyInfo(Variant::INT, "response_code"), PropertyInfo(Variant::PACKED_STRING_ARRAY, "headers"), PropertyInfo(Variant::PACKED_BYTE_ARRAY, "body")));
 
 	BIND_ENUM_CONSTANT(RESULT_SUCCESS);
@@ -659,10 +850,13 @@ void HTTPRequest::_bind_methods() {
 	BIND_ENUM_CONSTANT(RESULT_DOWNLOAD_FILE_WRITE_ERROR);
 	BIND_ENUM_CONSTANT(RESULT_REDIRECT_LIMIT_REACHED);
 	BIND_ENUM_CONSTANT(RESULT_TIMEOUT);
+
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "network/limits/http_request/max_connections_per_host", PROPERTY_HINT_RANGE, "0,64,1,or_greater"), 6);
 }
 
 HTTPRequest::HTTPRequest() {
-	client = Ref<HTTPClient>(HTTPClient::create());
+	default_client = Ref<HTTPClient>(HTTPClient::create());
+	client = default_client;
 	tls_options = TLSOptions::client();
 	timer = memnew(Timer);
 	timer->set_one_shot(true);
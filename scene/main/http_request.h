@@ -32,7 +32,10 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -61,6 +64,15 @@ public:
 	};
 
 private:
+	// Keep-alive connections shared by all the HTTPRequests, keyed by host.
+	struct ConnectionPool {
+		LocalVector<Ref<HTTPClient>> idle;
+		int open = 0; // Idle connections and connections in use.
+	};
+
+	static Mutex pool_mutex;
+	static HashMap<String, ConnectionPool> connection_pool;
+
 	bool requesting = false;
 
 	String request_string;
@@ -74,9 +86,22 @@ private:
 
 	bool request_sent = false;
 	Ref<HTTPClient> client;
+	mutable Mutex client_mutex; // The request thread can swap the pooled client while the main thread reads it.
+	Ref<HTTPClient> default_client;
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
+	bool stream_body = false;
+
+	bool use_connection_pool = false;
+	bool waiting_for_connection = false;
+	bool reused_connection = false;
+	String pool_key;
+
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
 
 	bool got_response = false;
 	int response_code = 0;
@@ -107,6 +132,14 @@ private:
 	Error _parse_url(const String &p_url);
 	Error _request();
 
+	String _get_pool_key() const;
+	void _set_client(const Ref<HTTPClient> &p_client);
+	bool _is_method_idempotent() const;
+	Error _acquire_pooled_client();
+	void _release_client(bool p_keep_alive);
+	bool _retry_pooled_connection();
+	void _stop_request(bool p_keep_alive);
+
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
 
@@ -117,6 +150,7 @@ private:
 
 	void _defer_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data);
 	void _request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data);
+	void _body_chunk_received(const PackedByteArray &p_chunk);
 	static void _thread_func(void *p_userdata);
 
 protected:
@@ -135,6 +169,12 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_use_connection_pool(bool p_enable);
+	bool is_using_connection_pool() const;
+
+	void set_stream_body(bool p_enable);
+	bool is_streaming_body() const;
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
@@ -162,6 +202,8 @@ public:
 
 	void set_tls_options(const Ref<TLSOptions> &p_options);
 
+	static void clear_connection_pool();
+
 	HTTPRequest();
 };
 
@@ -527,7 +527,9 @@ bool SceneTree::physics_process(double p_time) {
 
 	emit_signal(SNAME("physics_frame"));
 
-	call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
+	if (!rendering_updates_disabled) {
+		call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
+	}
 
 	_process(true);
 
@@ -641,7 +643,7 @@ bool SceneTree::process(double p_time) {
 #endif // _3D_DISABLED
 #endif // TOOLS_ENABLED
 
-	if (_physics_interpolation_enabled) {
+	if (_physics_interpolation_enabled && !rendering_updates_disabled) {
 		RenderingServer::get_singleton()->pre_draw(true);
 	}
 
@@ -1873,6 +1875,30 @@ void SceneTree::set_disable_node_threading(bool p_disable) {
 	node_threading_disabled = p_disable;
 }
 
+void SceneTree::set_disable_rendering_updates(bool p_disable) {
+	rendering_updates_disabled = p_disable;
+	if (p_disable) {
+		return;
+	}
+
+	// Replay the redraws requested in the meantime, skipping freed items.
+	LocalVector<Callable> redraws;
+	{
+		MutexLock lock(deferred_redraws_mutex);
+		SWAP(redraws, deferred_redraws);
+	}
+	for (const Callable &redraw : redraws) {
+		if (redraw.is_valid()) {
+			redraw.call_deferred();
+		}
+	}
+}
+
+void SceneTree::defer_redraw(const Callable &p_redraw) {
+	MutexLock lock(deferred_redraws_mutex);
+	deferred_redraws.push_back(p_redraw);
+}
+
 SceneTree::SceneTree() {
 	if (singleton == nullptr) {
 		singleton = this;
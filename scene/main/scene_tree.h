@@ -117,6 +117,9 @@ private:
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
+	bool rendering_updates_disabled = false;
+	Mutex deferred_redraws_mutex;
+	LocalVector<Callable> deferred_redraws; // Redraws queued while rendering updates are disabled.
 
 	struct Group {
 		Vector<Node *> nodes;
@@ -439,6 +442,11 @@ public:
 	static void add_idle_callback(IdleCallback p_callback);
 
 	void set_disable_node_threading(bool p_disable);
+
+	// Nothing is drawn, e.g. on a dedicated server.
+	void set_disable_rendering_updates(bool p_disable);
+	_FORCE_INLINE_ bool is_rendering_updates_disabled() const { return rendering_updates_disabled; }
+	void defer_redraw(const Callable &p_redraw);
 	//default texture settings
 
 	void set_physics_interpolation_enabled(bool p_enabled);
@@ -1281,6 +1281,7 @@ void unregister_scene_types() {
 	OS::get_singleton()->benchmark_begin_measure("Scene", "Unregister Types");
 
 	SceneDebugger::deinitialize();
+	HTTPRequest::clear_connection_pool();
 
 	ResourceLoader::remove_resource_format_loader(resource_loader_texture_layered);
 	resource_loader_texture_layered.unref();
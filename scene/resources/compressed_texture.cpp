@@ -31,6 +31,7 @@
 #include "compressed_texture.h"
 
 #include "scene/resources/bit_map.h"
+#include "servers/rendering/texture_streamer.h"
 
 Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
 	alpha_cache.unref();
@@ -79,15 +80,109 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 		p_size_limit = 0;
 	}
 
+	stream_size = Size2i();
+	if (p_size_limit > 0) {
+		// Peek at the image data header for the size the texture can later be streamed up to.
+		uint64_t data_pos = f->get_position();
+		uint32_t data_format = f->get_32();
+		int data_width = f->get_16();
+		int data_height = f->get_16();
+		stream_mipmaps = f->get_32();
+		f->seek(data_pos);
+
+		// Basis Universal data holds a single image, so it can't be loaded partially.
+		if (data_format == DATA_FORMAT_BASIS_UNIVERSAL || stream_mipmaps == 0 || MAX(data_width, data_height) <= p_size_limit) {
+			p_size_limit = 0;
+		} else {
+			stream_size = Size2i(data_width, data_height);
+		}
+	}
+
 	image = load_image_from_file(f, p_size_limit);
 
 	if (image.is_null() || image->is_empty()) {
+		stream_size = Size2i();
 		return ERR_CANT_OPEN;
 	}
 
 	return OK;
 }
 
+Ref<Image> CompressedTexture2D::_load_image_at_size(const String &p_path, int p_size_limit) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), Ref<Image>(), vformat("Unable to open file: %s.", p_path));
+
+	uint8_t header[4];
+	f->get_buffer(header, 4);
+	ERR_FAIL_COND_V_MSG(header[0] != 'G' || header[1] != 'S' || header[2] != 'T' || header[3] != '2', Ref<Image>(), "Compressed texture file is corrupt (Bad header).");
+
+	// Skip version, size, data format, mipmap limit and reserved fields; they were validated by the initial load.
+	f->seek(f->get_position() + 7 * sizeof(uint32_t));
+	return load_image_from_file(f, p_size_limit);
+}
+
+void CompressedTexture2D::_stream_task(void *p_userdata) {
+	CompressedTexture2D *ct = (CompressedTexture2D *)p_userdata;
+
+	while (true) {
+		int mip;
+		{
+			MutexLock lock(ct->stream_mutex);
+			if (ct->stream_target_mip == ct->stream_loaded_mip) {
+				ct->stream_loading = false;
+				return;
+			}
+			mip = ct->stream_target_mip;
+		}
+
+		int size_limit = mip > 0 ? MAX(ct->stream_size.width, ct->stream_size.height) >> mip : 0;
+		Ref<Image> image = _load_image_at_size(ct->path_to_file, size_limit);
+		if (image.is_valid() && !image->is_empty()) {
+			RID new_texture = RS::get_singleton()->texture_2d_create(image);
+			RS::get_singleton()->texture_replace(ct->texture, new_texture);
+			RS::get_singleton()->texture_set_size_override(ct->texture, ct->w, ct->h);
+		}
+
+		MutexLock lock(ct->stream_mutex);
+		ct->stream_loaded_mip = mip;
+	}
+}
+
+void CompressedTexture2D::_stream_set_resident_mip(int p_mip) {
+	{
+		MutexLock lock(stream_mutex);
+		stream_target_mip = p_mip;
+		if (stream_loading || stream_target_mip == stream_loaded_mip) {
+			// A running task picks up the new target when done with the current one.
+			return;
+		}
+		stream_loading = true;
+	}
+
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// The previous task has already seen there is nothing left to load.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+	}
+	stream_task = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_task, this, false, "CompressedTexture2D Stream");
+}
+
+void CompressedTexture2D::_stream_stop() {
+	if (stream_size == Size2i()) {
+		return;
+	}
+
+	TextureStreamer *streamer = TextureStreamer::get_singleton();
+	if (streamer) {
+		streamer->texture_remove(texture);
+	}
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	stream_loading = false;
+	stream_size = Size2i();
+}
+
 void CompressedTexture2D::set_path(const String &p_path, bool p_take_over) {
 	if (texture.is_valid()) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -135,7 +230,13 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	_stream_stop();
+
+	// When streaming, start with the smallest mipmaps and let the streamer ask for more as needed.
+	TextureStreamer *streamer = TextureStreamer::get_singleton();
+	int size_limit = streamer && streamer->is_enabled() ? streamer->get_min_resident_size() : 0;
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit);
 	if (err) {
 		return err;
 	}
@@ -160,6 +261,13 @@ Error CompressedTexture2D::load(const String &p_path) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
 	}
 
+	if (stream_size != Size2i()) {
+		int resident_mip = MAX(stream_mipmaps - image->get_mipmap_count(), 0);
+		stream_target_mip = resident_mip;
+		stream_loaded_mip = resident_mip;
+		streamer->texture_add(texture, stream_size.width, stream_size.height, stream_mipmaps, format, resident_mip, callable_mp(this, &CompressedTexture2D::_stream_set_resident_mip));
+	}
+
 #ifdef TOOLS_ENABLED
 
 	if (request_3d) {
@@ -237,7 +345,16 @@ bool CompressedTexture2D::has_alpha() const {
 }
 
 Ref<Image> CompressedTexture2D::get_image() const {
-	if (texture.is_valid()) {
+	bool full_size_resident = true;
+	if (stream_size != Size2i()) {
+		MutexLock lock(stream_mutex);
+		full_size_resident = stream_loaded_mip == 0;
+	}
+
+	if (!full_size_resident) {
+		// Only the smaller mipmaps are resident, read the full image from disk.
+		return _load_image_at_size(path_to_file, 0);
+	} else if (texture.is_valid()) {
 		return RS::get_singleton()->texture_2d_get(texture);
 	} else {
 		return Ref<Image>();
@@ -318,7 +435,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -326,18 +443,28 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			// Decode in place when the file can lend its memory (e.g. a mapped pack).
+			const uint8_t *view = f->get_buffer_view(size);
+			if (view) {
+				if (data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func) {
+					img = Image::_png_mem_unpacker_func(view, size);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::_webp_mem_loader_func) {
+					img = Image::_webp_mem_loader_func(view, size);
+				}
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -389,7 +516,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -404,14 +531,19 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			f->seek(f->get_position() + size);
 			return Ref<Image>();
 		}
-		Vector<uint8_t> pv;
-		pv.resize(size);
-		{
-			uint8_t *wr = pv.ptrw();
-			f->get_buffer(wr, size);
-		}
 		Ref<Image> img;
-		img = Image::basis_universal_unpacker(pv);
+		const uint8_t *view = f->get_buffer_view(size);
+		if (view) {
+			img = Image::basis_universal_unpacker_ptr(view, size);
+		} else {
+			Vector<uint8_t> pv;
+			pv.resize(size);
+			{
+				uint8_t *wr = pv.ptrw();
+				f->get_buffer(wr, size);
+			}
+			img = Image::basis_universal_unpacker(pv);
+		}
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
@@ -421,18 +553,20 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		return img;
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_pos = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			if (ofs) {
+				f->seek(data_pos + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -460,6 +594,7 @@ void CompressedTexture2D::_bind_methods() {
 CompressedTexture2D::CompressedTexture2D() {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_stream_stop();
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
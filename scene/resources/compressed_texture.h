@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource_loader.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -67,6 +68,20 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Texture streaming state, see TextureStreamer.
+	Size2i stream_size; // Size of the full resolution image data, empty when not streamed.
+	int stream_mipmaps = 0;
+	int stream_target_mip = 0;
+	int stream_loaded_mip = 0;
+	bool stream_loading = false;
+	mutable BinaryMutex stream_mutex;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static Ref<Image> _load_image_at_size(const String &p_path, int p_size_limit);
+	static void _stream_task(void *p_userdata);
+	void _stream_set_resident_mip(int p_mip);
+	void _stream_stop();
+
 	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
 	virtual void reload_from_file() override;
 
@@ -2775,6 +2775,10 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 	RendererSceneOcclusionCull::get_singleton()->buffer_update(p_viewport, camera_data.main_transform, camera_data.main_projection, camera_data.is_orthogonal);
 
 	_render_scene(&camera_data, p_render_buffers, environment, camera->attributes, compositor, camera->visible_layers, p_scenario, p_viewport, p_shadow_atlas, RID(), -1, p_screen_mesh_lod_threshold, true, r_render_info);
+
+	if (scene_cull_result.streamed_geometry.size()) {
+		_request_streamed_textures(&camera_data, p_viewport_size.width);
+	}
 #endif
 }
 
@@ -3106,6 +3110,9 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 					if (keep) {
 						cull_result.geometry_instances.push_back(idata.instance_geometry);
+						if (cull_data.texture_streaming) {
+							cull_result.streamed_geometry.push_back(idata.instance);
+						}
 					}
 				}
 			}
@@ -3167,6 +3174,69 @@ void RendererSceneCull::_scene_particles_set_view_axis(RID p_particles, const Ve
 	RSG::particles_storage->particles_set_view_axis(p_particles, p_axis, p_up_axis);
 }
 
+void RendererSceneCull::_request_streamed_textures(const RendererSceneRender::CameraData *p_camera_data, int p_viewport_width) {
+	// With multiple views (XR), each eye sees the instance at its own size, use the largest.
+	const uint32_t view_count = MAX(p_camera_data->view_count, 1u);
+	Vector3 view_positions[RendererSceneRender::MAX_RENDER_VIEWS];
+	real_t pixel_scales[RendererSceneRender::MAX_RENDER_VIEWS];
+	real_t z_near = p_camera_data->main_projection.get_z_near();
+	for (uint32_t v = 0; v < view_count; v++) {
+		const Projection &projection = view_count > 1 ? p_camera_data->view_projection[v] : p_camera_data->main_projection;
+		view_positions[v] = view_count > 1 ? (p_camera_data->main_transform * p_camera_data->view_offset[v]).origin : p_camera_data->main_transform.origin;
+		// Pixels covered by one unit of size at distance one (or anywhere, for orthogonal cameras).
+		pixel_scales[v] = p_viewport_width * 0.5 * projection.columns[0][0];
+		z_near = MIN(z_near, projection.get_z_near());
+	}
+
+	texture_streamer_requests.clear();
+
+	for (uint64_t i = 0; i < scene_cull_result.streamed_geometry.size(); i++) {
+		Instance *ins = scene_cull_result.streamed_geometry[i];
+		const AABB &aabb = ins->transformed_aabb;
+
+		real_t screen_size = 0.0;
+		for (uint32_t v = 0; v < view_count; v++) {
+			real_t view_screen_size = aabb.get_longest_axis_size() * pixel_scales[v];
+			if (!p_camera_data->is_orthogonal) {
+				// Use the closest point of the box, so large instances surrounding the camera get full detail.
+				Vector3 closest = view_positions[v].clamp(aabb.position, aabb.position + aabb.size);
+				view_screen_size /= MAX(view_positions[v].distance_to(closest), z_near);
+			}
+			screen_size = MAX(screen_size, view_screen_size);
+		}
+
+		TextureStreamer::MaterialRequest request;
+		request.screen_size = screen_size;
+
+		if (ins->material_override.is_valid()) {
+			request.material = ins->material_override;
+			texture_streamer_requests.push_back(request);
+		} else {
+			RID mesh;
+			if (ins->base_type == RS::INSTANCE_MESH) {
+				mesh = ins->base;
+			} else if (ins->base_type == RS::INSTANCE_MULTIMESH) {
+				mesh = RSG::mesh_storage->multimesh_get_mesh(ins->base);
+			}
+
+			int surface_count = mesh.is_valid() ? RSG::mesh_storage->mesh_get_surface_count(mesh) : 0;
+			for (int j = 0; j < surface_count; j++) {
+				request.material = j < ins->materials.size() && ins->materials[j].is_valid() ? ins->materials[j] : RSG::mesh_storage->mesh_surface_get_material(mesh, j);
+				if (request.material.is_valid()) {
+					texture_streamer_requests.push_back(request);
+				}
+			}
+		}
+
+		if (ins->material_overlay.is_valid()) {
+			request.material = ins->material_overlay;
+			texture_streamer_requests.push_back(request);
+		}
+	}
+
+	TextureStreamer::get_singleton()->request_materials(texture_streamer_requests.ptr(), texture_streamer_requests.size());
+}
+
 void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_camera_data, const Ref<RenderSceneBuffers> &p_render_buffers, RID p_environment, RID p_force_camera_attributes, RID p_compositor, uint32_t p_visible_layers, RID p_scenario, RID p_viewport, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, bool p_using_shadows, RenderingMethod::RenderInfo *r_render_info) {
 	Instance *render_reflection_probe = instance_owner.get_or_null(p_reflection_probe); //if null, not rendering to it
 
@@ -3304,6 +3374,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
 		cull_data.camera_matrix = &p_camera_data->main_projection;
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
+		cull_data.texture_streaming = p_reflection_probe.is_null() && TextureStreamer::get_singleton() && TextureStreamer::get_singleton()->is_enabled();
 //#define DEBUG_CULL_TIME
 #ifdef DEBUG_CULL_TIME
 		uint64_t time_from = OS::get_singleton()->get_ticks_usec();
@@ -30,6 +30,7 @@
 
 #include "rendering_server_default.h"
 
+#include "core/config/project_settings.h"
 #include "core/os/os.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
@@ -98,6 +99,8 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	RSG::canvas->update_visibility_notifiers();
 	RSG::scene->update_visibility_notifiers();
 
+	texture_streamer.update();
+
 	if (create_thread) {
 		callable_mp(this, &RenderingServerDefault::_run_post_draw_steps).call_deferred();
 	} else {
@@ -429,11 +432,25 @@ void RenderingServerDefault::_call_on_render_thread(const Callable &p_callable)
 	p_callable.call();
 }
 
+void RenderingServerDefault::_update_texture_streaming_settings() {
+	texture_streamer.set_budget(uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024);
+	texture_streamer.set_min_resident_size(GLOBAL_GET("rendering/textures/streaming/min_resident_size"));
+}
+
 RenderingServerDefault::RenderingServerDefault(bool p_create_thread) {
 	RenderingServer::init();
 
 	create_thread = p_create_thread;
+
+	TextureStreamer::set_singleton(&texture_streamer);
+	// Changing it needs a restart, textures already loaded wouldn't be streamed.
+	texture_streamer.set_enabled(GLOBAL_GET("rendering/textures/streaming/enabled"));
+	_update_texture_streaming_settings();
+	ProjectSettings::get_singleton()->connect("settings_changed", callable_mp(this, &RenderingServerDefault::_update_texture_streaming_settings));
 }
 
 RenderingServerDefault::~RenderingServerDefault() {
+	if (TextureStreamer::get_singleton() == &texture_streamer) {
+		TextureStreamer::set_singleton(nullptr);
+	}
 }
@@ -38,6 +38,7 @@
 #include "renderer_viewport.h"
 #include "rendering_server_globals.h"
 #include "servers/rendering/renderer_compositor.h"
+#include "servers/rendering/texture_streamer.h"
 #include "servers/rendering_server.h"
 #include "servers/server_wrap_mt_common.h"
 
@@ -79,6 +80,10 @@ class RenderingServerDefault : public RenderingServer {
 	bool exit = false;
 	bool create_thread = false;
 
+	TextureStreamer texture_streamer;
+
+	void _update_texture_streaming_settings();
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_loop();
@@ -303,7 +308,18 @@ public:
 
 	FUNC2(material_set_shader, RID, RID)
 
-	FUNC3(material_set_param, RID, const StringName &, const Variant &)
+	virtual void material_set_param(RID p_material, const StringName &p_param, const Variant &p_value) override {
+		// Track which textures a material samples, so the streamer can map visible materials back to textures.
+		texture_streamer.material_set_param(p_material, p_param, p_value);
+
+		WRITE_ACTION
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(RSG::material_storage, &RendererMaterialStorage::material_set_param, p_material, p_param, p_value);
+		} else {
+			command_queue.flush_if_pending();
+			RSG::material_storage->material_set_param(p_material, p_param, p_value);
+		}
+	}
 	FUNC2RC(Variant, material_get_param, RID, const StringName &)
 
 	FUNC2(material_set_render_priority, RID, int)
@@ -1124,6 +1140,7 @@ public:
 	/* FREE */
 
 	virtual void free(RID p_rid) override {
+		texture_streamer.free(p_rid);
 		if (Thread::get_caller_id() == server_thread) {
 			command_queue.flush_if_pending();
 			_free(p_rid);
@@ -0,0 +1,327 @@
+/**************************************************************************/
+/*  texture_streamer.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "texture_streamer.h"
+
+#include "core/object/object.h"
+
+TextureStreamer *TextureStreamer::singleton = nullptr;
+
+uint64_t TextureStreamer::_get_mip_memory(const StreamedTexture &p_texture, int p_mip) {
+	int mip = CLAMP(p_mip, 0, p_texture.mipmaps);
+	int w = MAX(p_texture.width >> mip, 1);
+	int h = MAX(p_texture.height >> mip, 1);
+	return Image::get_image_data_size(w, h, p_texture.format, mip < p_texture.mipmaps);
+}
+
+int TextureStreamer::_get_min_mip(int p_width, int p_height, int p_mipmaps) const {
+	int mip = 0;
+	int size = MAX(p_width, p_height);
+	while (mip < p_mipmaps && (size >> mip) > min_resident_size) {
+		mip++;
+	}
+	return mip;
+}
+
+void TextureStreamer::_request(StreamedTexture &p_texture, float p_screen_size) {
+	int mip = p_texture.min_mip;
+	float size = MAX(p_texture.width, p_texture.height);
+	if (p_screen_size >= size) {
+		mip = 0;
+	} else if (p_screen_size >= 1.0) {
+		mip = MIN(int(Math::floor(Math::log2(size / p_screen_size))), p_texture.min_mip);
+	}
+
+	p_texture.requested_mip = p_texture.requested_mip < 0 ? mip : MIN(p_texture.requested_mip, mip);
+	p_texture.last_used_frame = frame;
+}
+
+void TextureStreamer::set_enabled(bool p_enabled) {
+	LocalVector<Callable> reduced_callables;
+	{
+		MutexLock lock(mutex);
+		enabled.set_to(p_enabled);
+		if (p_enabled) {
+			return;
+		}
+
+		for (const KeyValue<RID, StreamedTexture> &E : textures) {
+			if (E.value.resident_mip != 0 && E.value.set_resident_mip.is_valid()) {
+				reduced_callables.push_back(E.value.set_resident_mip);
+			}
+		}
+		textures.clear();
+		material_textures.clear();
+		resident_memory = 0;
+	}
+
+	for (const Callable &callable : reduced_callables) {
+		callable.call_deferred(0);
+	}
+}
+
+void TextureStreamer::set_budget(uint64_t p_bytes) {
+	MutexLock lock(mutex);
+	budget = p_bytes;
+}
+
+uint64_t TextureStreamer::get_budget() const {
+	MutexLock lock(mutex);
+	return budget;
+}
+
+void TextureStreamer::set_min_resident_size(int p_size) {
+	ERR_FAIL_COND(p_size < 1);
+	MutexLock lock(mutex);
+	min_resident_size = p_size;
+	for (KeyValue<RID, StreamedTexture> &E : textures) {
+		E.value.min_mip = _get_min_mip(E.value.width, E.value.height, E.value.mipmaps);
+	}
+}
+
+int TextureStreamer::get_min_resident_size() const {
+	MutexLock lock(mutex);
+	return min_resident_size;
+}
+
+void TextureStreamer::texture_add(RID p_texture, int p_width, int p_height, int p_mipmaps, Image::Format p_format, int p_resident_mip, const Callable &p_set_resident_mip) {
+	ERR_FAIL_COND(p_texture.is_null());
+	ERR_FAIL_COND(p_width <= 0 || p_height <= 0 || p_mipmaps < 0);
+
+	MutexLock lock(mutex);
+	if (!enabled.is_set()) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(textures.has(p_texture), "Texture is already streamed.");
+
+	StreamedTexture texture;
+	texture.width = p_width;
+	texture.height = p_height;
+	texture.mipmaps = p_mipmaps;
+	texture.format = p_format;
+	texture.min_mip = _get_min_mip(p_width, p_height, p_mipmaps);
+	texture.resident_mip = CLAMP(p_resident_mip, 0, p_mipmaps);
+	texture.last_used_frame = frame;
+	texture.set_resident_mip = p_set_resident_mip;
+
+	resident_memory += _get_mip_memory(texture, texture.resident_mip);
+	textures.insert(p_texture, texture);
+}
+
+void TextureStreamer::texture_remove(RID p_texture) {
+	if (!enabled.is_set()) {
+		return; // Nothing is tracked.
+	}
+
+	MutexLock lock(mutex);
+	HashMap<RID, StreamedTexture>::Iterator E = textures.find(p_texture);
+	if (!E) {
+		return;
+	}
+	resident_memory -= _get_mip_memory(E->value, E->value.resident_mip);
+	textures.remove(E);
+}
+
+bool TextureStreamer::texture_is_streamed(RID p_texture) const {
+	MutexLock lock(mutex);
+	return textures.has(p_texture);
+}
+
+int TextureStreamer::texture_get_resident_mip(RID p_texture) const {
+	MutexLock lock(mutex);
+	const StreamedTexture *texture = textures.getptr(p_texture);
+	ERR_FAIL_NULL_V(texture, -1);
+	return texture->resident_mip;
+}
+
+void TextureStreamer::texture_request(RID p_texture, float p_screen_size) {
+	MutexLock lock(mutex);
+	StreamedTexture *texture = textures.getptr(p_texture);
+	if (texture) {
+		_request(*texture, p_screen_size);
+	}
+}
+
+void TextureStreamer::material_set_param(RID p_material, const StringName &p_param, const Variant &p_value) {
+	if (!enabled.is_set()) {
+		return;
+	}
+
+	MutexLock lock(mutex);
+	if (!enabled.is_set()) {
+		return; // Disabled meanwhile.
+	}
+	if (p_value.get_type() == Variant::RID && RID(p_value).is_valid()) {
+		material_textures[p_material][p_param] = p_value;
+	} else {
+		HashMap<RID, HashMap<StringName, RID>>::Iterator E = material_textures.find(p_material);
+		if (E) {
+			E->value.erase(p_param);
+			if (E->value.is_empty()) {
+				material_textures.remove(E);
+			}
+		}
+	}
+}
+
+void TextureStreamer::request_materials(const MaterialRequest *p_requests, uint32_t p_count) {
+	MutexLock lock(mutex);
+	if (textures.is_empty()) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const HashMap<StringName, RID> *params = material_textures.getptr(p_requests[i].material);
+		if (!params) {
+			continue;
+		}
+		for (const KeyValue<StringName, RID> &E : *params) {
+			StreamedTexture *texture = textures.getptr(E.value);
+			if (texture) {
+				_request(*texture, p_requests[i].screen_size);
+			}
+		}
+	}
+}
+
+void TextureStreamer::free(RID p_rid) {
+	if (!enabled.is_set()) {
+		return; // Nothing is tracked.
+	}
+
+	MutexLock lock(mutex);
+	material_textures.erase(p_rid);
+	HashMap<RID, StreamedTexture>::Iterator E = textures.find(p_rid);
+	if (E) {
+		resident_memory -= _get_mip_memory(E->value, E->value.resident_mip);
+		textures.remove(E);
+	}
+}
+
+uint64_t TextureStreamer::get_resident_memory() const {
+	MutexLock lock(mutex);
+	return resident_memory;
+}
+
+void TextureStreamer::update() {
+	struct Candidate {
+		StreamedTexture *texture = nullptr;
+		int mip = 0;
+		int needed_mip = 0;
+	};
+
+	struct CandidateSort {
+		_FORCE_INLINE_ bool operator()(const Candidate &p_a, const Candidate &p_b) const {
+			return p_a.texture->last_used_frame < p_b.texture->last_used_frame;
+		}
+	};
+
+	LocalVector<Callable> changed_callables;
+	LocalVector<int> changed_mips;
+
+	{
+		MutexLock lock(mutex);
+		if (textures.is_empty()) {
+			frame++;
+			return;
+		}
+
+		LocalVector<Candidate> candidates;
+		candidates.reserve(textures.size());
+		uint64_t total = 0;
+
+		for (KeyValue<RID, StreamedTexture> &E : textures) {
+			StreamedTexture &texture = E.value;
+			Candidate candidate;
+			candidate.texture = &texture;
+			// Detail is only dropped when over budget, so keep what is resident if it is enough.
+			candidate.mip = texture.requested_mip >= 0 ? MIN(texture.requested_mip, texture.resident_mip) : texture.resident_mip;
+			candidate.needed_mip = texture.requested_mip >= 0 ? texture.requested_mip : texture.min_mip;
+			texture.requested_mip = -1;
+			total += _get_mip_memory(texture, candidate.mip);
+			candidates.push_back(candidate);
+		}
+
+		if (budget > 0 && total > budget) {
+			candidates.sort_custom<CandidateSort>();
+
+			// Free detail nothing asked for, starting with the least recently used textures.
+			for (Candidate &candidate : candidates) {
+				if (total <= budget) {
+					break;
+				}
+				if (candidate.mip < candidate.needed_mip) {
+					total -= _get_mip_memory(*candidate.texture, candidate.mip) - _get_mip_memory(*candidate.texture, candidate.needed_mip);
+					candidate.mip = candidate.needed_mip;
+				}
+			}
+
+			// Still over budget, take one mipmap at a time from the visible textures.
+			bool dropped = true;
+			while (total > budget && dropped) {
+				dropped = false;
+				for (Candidate &candidate : candidates) {
+					if (total <= budget) {
+						break;
+					}
+					if (candidate.mip < candidate.texture->min_mip) {
+						total -= _get_mip_memory(*candidate.texture, candidate.mip) - _get_mip_memory(*candidate.texture, candidate.mip + 1);
+						candidate.mip++;
+						dropped = true;
+					}
+				}
+			}
+		}
+
+		for (const Candidate &candidate : candidates) {
+			StreamedTexture &texture = *candidate.texture;
+			if (candidate.mip == texture.resident_mip) {
+				continue;
+			}
+			resident_memory = resident_memory - _get_mip_memory(texture, texture.resident_mip) + _get_mip_memory(texture, candidate.mip);
+			texture.resident_mip = candidate.mip;
+			if (texture.set_resident_mip.is_valid()) {
+				changed_callables.push_back(texture.set_resident_mip);
+				changed_mips.push_back(candidate.mip);
+			}
+		}
+
+		frame++;
+	}
+
+	for (uint32_t i = 0; i < changed_callables.size(); i++) {
+		changed_callables[i].call_deferred(changed_mips[i]);
+	}
+}
+
+void TextureStreamer::set_singleton(TextureStreamer *p_singleton) {
+	singleton = p_singleton;
+}
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  texture_streamer.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/io/image.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/callable.h"
+
+// Keeps track of which mipmaps of streamed textures should be resident.
+// Textures register with their full size and the mipmap they were loaded at.
+// The scene cull reports how many pixels each visible material covers, and once
+// per frame update() picks the mipmap each texture needs, lowering detail on the
+// least recently used textures when the total would exceed the memory budget.
+// Loading is left to the owner of the texture, which is notified (deferred, on
+// the main thread) through the callable passed to texture_add().
+class TextureStreamer {
+	static TextureStreamer *singleton;
+
+	struct StreamedTexture {
+		int width = 0;
+		int height = 0;
+		int mipmaps = 0;
+		Image::Format format = Image::FORMAT_L8;
+		int min_mip = 0; // Lowest detail that always stays resident.
+		int resident_mip = 0;
+		int requested_mip = -1; // Most detailed mipmap requested this frame, -1 if none.
+		uint64_t last_used_frame = 0;
+		Callable set_resident_mip;
+	};
+
+	mutable Mutex mutex;
+	HashMap<RID, StreamedTexture> textures;
+	HashMap<RID, HashMap<StringName, RID>> material_textures;
+
+	// Read without the mutex as a fast path, and checked again under it before tracking anything.
+	SafeFlag enabled;
+	uint64_t budget = 0;
+	uint64_t resident_memory = 0;
+	int min_resident_size = 128;
+	uint64_t frame = 0;
+
+	static uint64_t _get_mip_memory(const StreamedTexture &p_texture, int p_mip);
+	int _get_min_mip(int p_width, int p_height, int p_mipmaps) const;
+	void _request(StreamedTexture &p_texture, float p_screen_size);
+
+public:
+	struct MaterialRequest {
+		RID material;
+		float screen_size = 0.0;
+	};
+
+	// Registered by the rendering server that owns it, other instances stay local.
+	static void set_singleton(TextureStreamer *p_singleton);
+	static TextureStreamer *get_singleton() { return singleton; }
+
+	// Disabling drops everything tracked, and has streamed textures load their full size.
+	void set_enabled(bool p_enabled);
+	bool is_enabled() const { return enabled.is_set(); }
+
+	void set_budget(uint64_t p_bytes);
+	uint64_t get_budget() const;
+
+	void set_min_resident_size(int p_size);
+	int get_min_resident_size() const;
+
+	void texture_add(RID p_texture, int p_width, int p_height, int p_mipmaps, Image::Format p_format, int p_resident_mip, const Callable &p_set_resident_mip);
+	void texture_remove(RID p_texture);
+	bool texture_is_streamed(RID p_texture) const;
+	int texture_get_resident_mip(RID p_texture) const;
+	void texture_request(RID p_texture, float p_screen_size);
+
+	void material_set_param(RID p_material, const StringName &p_param, const Variant &p_value);
+	void request_materials(const MaterialRequest *p_requests, uint32_t p_count);
+
+	void free(RID p_rid);
+
+	uint64_t get_resident_memory() const;
+
+	void update();
+};
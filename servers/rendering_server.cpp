@@ -3593,6 +3593,10 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF("rendering/textures/lossless_compression/force_png", false);
 
+	GLOBAL_DEF_RST("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater,suffix:MiB"), 1024);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/min_resident_size", PROPERTY_HINT_RANGE, "16,4096,1,or_greater"), 128);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/webp_compression/compression_method", PROPERTY_HINT_RANGE, "0,6,1"), 2);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"), 25);
 
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  test_gdextension_interface.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/extension/gdextension.h"
+#include "core/extension/gdextension_interface.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGDExtensionInterface {
+
+TEST_CASE("[GDExtensionInterface] Packed array data pointers") {
+	GDExtensionInterfacePackedArrayGetReadPtr get_read_ptr = (GDExtensionInterfacePackedArrayGetReadPtr)GDExtension::get_interface_function("packed_array_get_read_ptr");
+	GDExtensionInterfacePackedArrayGetWritePtr get_write_ptr = (GDExtensionInterfacePackedArrayGetWritePtr)GDExtension::get_interface_function("packed_array_get_write_ptr");
+	REQUIRE(get_read_ptr);
+	REQUIRE(get_write_ptr);
+
+	PackedFloat32Array array = { 1, 2, 3 };
+	const PackedFloat32Array shared = array;
+
+	GDExtensionInt size = 0;
+	const void *read = get_read_ptr(&array, GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT32_ARRAY, &size);
+	CHECK(size == 3);
+	CHECK_MESSAGE(read == shared.ptr(), "Reading must not copy shared data.");
+
+	float *write = (float *)get_write_ptr(&array, GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT32_ARRAY, &size);
+	CHECK(size == 3);
+	CHECK_MESSAGE(write != shared.ptr(), "Writing must copy shared data.");
+	write[0] = 10;
+	CHECK(array[0] == 10);
+	CHECK(shared[0] == 1);
+
+	CHECK_MESSAGE(get_write_ptr(&array, GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT32_ARRAY, nullptr) == write, "Unique data must not be copied again.");
+
+	ERR_PRINT_OFF;
+	CHECK(get_read_ptr(&array, GDEXTENSION_VARIANT_TYPE_ARRAY, &size) == nullptr);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[GDExtensionInterface] Packed array move") {
+	GDExtensionInterfacePackedArrayMove move = (GDExtensionInterfacePackedArrayMove)GDExtension::get_interface_function("packed_array_move");
+	REQUIRE(move);
+
+	PackedByteArray source = { 1, 2, 3, 4 };
+	const uint8_t *data = source.ptr();
+	PackedByteArray dest = { 5 };
+
+	move(&dest, &source, GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY);
+	CHECK(source.is_empty());
+	CHECK(dest.size() == 4);
+	CHECK_MESSAGE(dest.ptr() == data, "The data must be transferred, not copied.");
+}
+
+} // namespace TestGDExtensionInterface
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/os/semaphore.h"
+#include "core/templates/safe_refcount.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -198,4 +200,115 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Buffer views") {
+	const String file_path = TestUtils::get_data_path("testdata.csv");
+	const Vector<uint8_t> contents = FileAccess::get_file_as_bytes(file_path);
+	REQUIRE(contents.size() > 16);
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(4);
+	const uint8_t *view = f->get_buffer_view(8);
+	if (view) {
+		CHECK(memcmp(view, contents.ptr() + 4, 8) == 0);
+		CHECK(f->get_position() == 12);
+		// Reading normally continues after the view.
+		CHECK(f->get_8() == contents[12]);
+	} else {
+		// Not every platform supports views, the position must be left alone then.
+		CHECK(f->get_position() == 4);
+	}
+
+	// Views past the end are refused.
+	f->seek(contents.size() - 4);
+	CHECK(f->get_buffer_view(8) == nullptr);
+	CHECK(f->get_position() == uint64_t(contents.size() - 4));
+	f->close();
+
+	// Writable files never hand out views. Use a copy, the test data must stay untouched.
+	const String file_path_copy = TestUtils::get_temp_path("buffer_views.csv");
+	Ref<FileAccess> fw = FileAccess::open(file_path_copy, FileAccess::WRITE_READ);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer(contents);
+	fw->seek(0);
+	CHECK(fw->get_buffer_view(8) == nullptr);
+	CHECK(fw->get_position() == 0);
+	fw->close();
+	DirAccess::remove_file_or_error(file_path_copy);
+}
+
+struct AsyncReadResult {
+	Semaphore done;
+	int64_t read = -2;
+	SafeNumeric<uint32_t> *finished = nullptr;
+};
+
+static void _async_read_callback(void *p_userdata, int64_t p_read) {
+	AsyncReadResult *result = (AsyncReadResult *)p_userdata;
+	result->read = p_read;
+	if (result->finished) {
+		result->finished->increment();
+	}
+	result->done.post();
+}
+
+TEST_CASE("[FileAccess] Asynchronous reads") {
+	const String file_path = TestUtils::get_data_path("testdata.csv");
+	const Vector<uint8_t> contents = FileAccess::get_file_as_bytes(file_path);
+	REQUIRE(contents.size() > 16);
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(2);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(contents.size());
+	AsyncReadResult result;
+	if (!f->read_async(4, buffer.ptrw(), 8, &_async_read_callback, &result)) {
+		// Not every platform reads in the background.
+		return;
+	}
+	result.done.wait();
+	CHECK(result.read == 8);
+	CHECK(memcmp(buffer.ptr(), contents.ptr() + 4, 8) == 0);
+	// The file position isn't used.
+	CHECK(f->get_position() == 2);
+	CHECK(f->get_8() == contents[2]);
+
+	SUBCASE("Reads past the end are cut short") {
+		AsyncReadResult tail;
+		REQUIRE(f->read_async(contents.size() - 4, buffer.ptrw(), 8, &_async_read_callback, &tail));
+		tail.done.wait();
+		CHECK(tail.read == 4);
+		CHECK(memcmp(buffer.ptr(), contents.ptr() + contents.size() - 4, 4) == 0);
+	}
+
+	SUBCASE("Prefetching") {
+		AsyncReadResult prefetch;
+		REQUIRE(f->read_async(0, nullptr, contents.size(), &_async_read_callback, &prefetch));
+		prefetch.done.wait();
+		CHECK(prefetch.read == contents.size());
+	}
+
+	SUBCASE("Many reads at once") {
+		// More than fit in flight at once, the rest has to queue.
+		const int count = 300;
+		SafeNumeric<uint32_t> finished;
+		Vector<uint8_t> targets;
+		targets.resize(count * 8);
+		AsyncReadResult *results = memnew_arr(AsyncReadResult, count);
+		for (int i = 0; i < count; i++) {
+			results[i].finished = &finished;
+			REQUIRE(f->read_async(i % 8, targets.ptrw() + i * 8, 8, &_async_read_callback, &results[i]));
+		}
+		for (int i = 0; i < count; i++) {
+			results[i].done.wait();
+			CHECK(results[i].read == 8);
+			CHECK(memcmp(targets.ptr() + i * 8, contents.ptr() + i % 8, 8) == 0);
+		}
+		CHECK(finished.get() == count);
+		memdelete_arr(results);
+	}
+}
+
 } // namespace TestFileAccess
@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/io/json.h"
 
+#include "tests/test_utils.h"
 #include "thirdparty/doctest/doctest.h"
 
 namespace TestJSON {
@@ -316,4 +319,61 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+TEST_CASE("[JSON] Parsing strings with escapes between plain text") {
+	JSON json;
+
+	json.parse("[\"plain\", \"a\\nb\\\"c\\u00e9d\", \"\\t\", \"multi\nline\", true]");
+	Array array = json.get_data();
+	REQUIRE(array.size() == 5);
+	CHECK(array[0] == "plain");
+	CHECK(array[1] == String::utf8("a\nb\"céd"));
+	CHECK(array[2] == "\t");
+	CHECK(array[3] == "multi\nline");
+	CHECK(array[4] == Variant(true));
+
+	ERR_PRINT_OFF
+	CHECK(json.parse("[\"one\",\n\"two\n\nthree\",\nfalse, nope]") == ERR_PARSE_ERROR);
+	CHECK(json.get_error_line() == 4);
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSON] Serialization of nested values") {
+	Dictionary dict;
+	Array array;
+	array.push_back(1.0 / 3.0);
+	array.push_back("text");
+	array.push_back(Variant());
+	dict["b"] = array;
+	dict["a"] = Dictionary();
+
+	CHECK(JSON::stringify(dict, "", true) == "{\"a\":{},\"b\":[0.333333333333333,\"text\",null]}");
+	CHECK(JSON::stringify(dict, "  ", true) == "{\n  \"a\": {\n\n  },\n  \"b\": [\n    0.333333333333333,\n    \"text\",\n    null\n  ]\n}");
+
+	// Full precision applies to nested values too.
+	CHECK(JSON::stringify(array, "", true, true) == "[0.333333333333333315,\"text\",null]");
+}
+
+TEST_CASE("[JSON] Serialization to a file") {
+	Array array;
+	for (int i = 0; i < 50000; i++) {
+		Dictionary entry;
+		entry["index"] = i;
+		entry["name"] = vformat("entry_%d", i);
+		array.push_back(entry);
+	}
+	const String expected = JSON::stringify(array, "\t");
+	// Large enough to be flushed to the file several times.
+	CHECK(expected.length() > 1024 * 1024);
+
+	const String path = TestUtils::get_temp_path("json_stringify_to_file.json");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		CHECK(JSON::stringify_to_file(f, array, "\t") == OK);
+	}
+	CHECK(FileAccess::get_file_as_string(path) == expected);
+
+	DirAccess::remove_absolute(path);
+}
 } // namespace TestJSON
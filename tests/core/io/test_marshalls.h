@@ -489,4 +489,183 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] MarshallSchema roundtrip") {
+	Dictionary item;
+	item["id"] = 0;
+	item["count"] = 0;
+	Dictionary tmpl;
+	tmpl["id"] = 0;
+	tmpl["position"] = Vector3();
+	tmpl["name"] = String();
+	tmpl["alive"] = false;
+	tmpl["health"] = 0.0;
+	tmpl["cell"] = Vector2i();
+	tmpl["scores"] = Array(TypedArray<int>());
+	Array items_template;
+	items_template.push_back(item);
+	tmpl["items"] = items_template;
+	tmpl["extra"] = Variant();
+
+	Ref<MarshallSchema> schema = MarshallSchema::from_template(tmpl);
+	REQUIRE(schema->get_field_count() == 9);
+	CHECK(schema->get_field_name(1) == "position");
+	CHECK(schema->get_field_type(1) == Variant::VECTOR3);
+
+	Dictionary data;
+	data["id"] = -5;
+	data["position"] = Vector3(1, 2, 3);
+	data["name"] = String::utf8("Ünïcödé");
+	data["alive"] = true;
+	data["health"] = 73; // Converted to float.
+	data["cell"] = Vector2i(-300, 7);
+	Array scores_data;
+	scores_data.push_back(1);
+	scores_data.push_back(1000000);
+	scores_data.push_back(-2);
+	data["scores"] = scores_data;
+	Dictionary entry;
+	entry["id"] = 3;
+	entry["count"] = 12;
+	Array items_data;
+	items_data.push_back(entry);
+	items_data.push_back(entry);
+	data["items"] = items_data;
+	data["extra"] = "any";
+	data["ignored"] = 1;
+
+	int len = 0;
+	REQUIRE(schema->encode(data, nullptr, len) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	REQUIRE(schema->encode(data, buffer.ptrw(), len) == OK);
+	CHECK(len == buffer.size());
+
+	Dictionary decoded;
+	int used = 0;
+	REQUIRE(schema->decode(buffer.ptr(), buffer.size(), decoded, &used) == OK);
+	CHECK(used == buffer.size());
+	CHECK(decoded.size() == 9);
+	CHECK(int(decoded["id"]) == -5);
+	CHECK(decoded["position"] == Variant(Vector3(1, 2, 3)));
+	CHECK(decoded["name"] == Variant(String::utf8("Ünïcödé")));
+	CHECK(decoded["alive"] == Variant(true));
+	CHECK(decoded["health"].get_type() == Variant::FLOAT);
+	CHECK(double(decoded["health"]) == 73.0);
+	CHECK(decoded["cell"] == Variant(Vector2i(-300, 7)));
+	Array scores = decoded["scores"];
+	CHECK(scores.get_typed_builtin() == Variant::INT);
+	CHECK(scores == scores_data);
+	Array items = decoded["items"];
+	REQUIRE(items.size() == 2);
+	CHECK(Dictionary(items[1]) == entry);
+	CHECK(decoded["extra"] == Variant("any"));
+	CHECK_FALSE(decoded.has("ignored"));
+
+	// Without field names and type headers, the payload is much smaller.
+	int variant_len = 0;
+	REQUIRE(encode_variant(data, nullptr, variant_len) == OK);
+	CHECK(len * 3 < variant_len);
+}
+
+TEST_CASE("[Marshalls] MarshallSchema invalid data") {
+	Ref<MarshallSchema> schema;
+	schema.instantiate();
+	schema->add_field("id", Variant::INT);
+	schema->add_field("name", Variant::STRING);
+
+	Dictionary data;
+	data["id"] = 1000;
+	data["name"] = "Godot";
+	PackedByteArray bytes = schema->call("encode", data);
+	CHECK(bytes.size() == 8);
+
+	ERR_PRINT_OFF;
+	for (int i = 0; i < bytes.size(); i++) {
+		Dictionary decoded;
+		CHECK(schema->decode(bytes.ptr(), i, decoded) == ERR_INVALID_DATA);
+	}
+
+	Dictionary missing;
+	missing["id"] = 1;
+	int len = 0;
+	CHECK(schema->encode(missing, nullptr, len) == ERR_INVALID_DATA);
+
+	data["id"] = Vector3();
+	CHECK(schema->encode(data, nullptr, len) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+
+	Dictionary decoded = schema->call("decode", bytes);
+	CHECK(int(decoded["id"]) == 1000);
+	CHECK(decoded["name"] == Variant("Godot"));
+}
+
+TEST_CASE("[Marshalls] MarshallSchema nested schemas") {
+	Ref<MarshallSchema> outer;
+	outer.instantiate();
+	Ref<MarshallSchema> middle;
+	middle.instantiate();
+	Ref<MarshallSchema> inner;
+	inner.instantiate();
+	outer->add_field("middle", Variant::DICTIONARY, Variant::NIL, middle);
+	middle->add_field("inner", Variant::DICTIONARY, Variant::NIL, inner);
+
+	ERR_PRINT_OFF;
+	inner->add_field("outer", Variant::DICTIONARY, Variant::NIL, outer);
+	inner->add_field("self", Variant::ARRAY, Variant::DICTIONARY, inner);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(inner->get_field_count() == 0, "Cycles through other schemas should be rejected.");
+
+	// A schema can still be shared by several fields.
+	outer->add_field("other_inner", Variant::DICTIONARY, Variant::NIL, inner);
+	CHECK(outer->get_field_count() == 2);
+}
+
+TEST_CASE("[Marshalls] MarshallSchema records without fields") {
+	Ref<MarshallSchema> empty;
+	empty.instantiate();
+	Ref<MarshallSchema> schema;
+	schema.instantiate();
+	schema->add_field("records", Variant::ARRAY, Variant::DICTIONARY, empty);
+
+	Array records;
+	records.resize(MarshallSchema::MAX_EMPTY_RECORDS);
+	records.fill(Dictionary());
+	Dictionary data;
+	data["records"] = records;
+	PackedByteArray bytes = schema->call("encode", data);
+	REQUIRE(bytes.size() == 3);
+	Dictionary decoded = schema->call("decode", bytes);
+	CHECK(Array(decoded["records"]).size() == MarshallSchema::MAX_EMPTY_RECORDS);
+
+	records.push_back(Dictionary());
+	data["records"] = records;
+	int len = 0;
+	ERR_PRINT_OFF;
+	CHECK(schema->encode(data, nullptr, len) == ERR_INVALID_DATA);
+
+	// A length over the limit is rejected without allocating the array.
+	const uint8_t huge[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x07 };
+	Dictionary huge_decoded;
+	CHECK(schema->decode(huge, sizeof(huge), huge_decoded) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls] MarshallSchema stores real_t as 32-bit floats") {
+	Ref<MarshallSchema> schema;
+	schema.instantiate();
+	schema->add_field("position", Variant::VECTOR3);
+	schema->add_field("transform", Variant::TRANSFORM2D);
+
+	Dictionary data;
+	data["position"] = Vector3(1.5, -2, 3);
+	data["transform"] = Transform2D(0.5, Vector2(10, 20));
+	PackedByteArray bytes = schema->call("encode", data);
+	// The size doesn't depend on whether the engine uses double precision.
+	CHECK(bytes.size() == (3 + 6) * 4);
+
+	Dictionary decoded = schema->call("decode", bytes);
+	CHECK(decoded["position"] == Variant(Vector3(1.5, -2, 3)));
+	CHECK(Transform2D(decoded["transform"]).is_equal_approx(Transform2D(0.5, Vector2(10, 20))));
+}
+
 } // namespace TestMarshalls
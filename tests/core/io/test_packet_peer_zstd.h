@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  test_packet_peer_zstd.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/packet_peer.h"
+#include "core/io/packet_peer_zstd.h"
+#include "core/io/stream_peer.h"
+#include "core/math/random_number_generator.h"
+#include "tests/test_macros.h"
+
+namespace TestPacketPeerZSTD {
+
+Ref<PacketPeerZSTD> create_peer(const Ref<StreamPeerBuffer> &p_buffer, bool p_streaming, const Vector<uint8_t> &p_dictionary = Vector<uint8_t>()) {
+	Ref<PacketPeerStream> pps;
+	pps.instantiate();
+	pps->set_stream_peer(p_buffer);
+
+	Ref<PacketPeerZSTD> peer;
+	peer.instantiate();
+	peer->set_packet_peer(pps);
+	peer->set_streaming(p_streaming);
+	peer->set_dictionary(p_dictionary);
+	return peer;
+}
+
+// Packets similar to the ones sent by a MultiplayerSynchronizer: a few nodes with slowly changing positions and constant names.
+Vector<Vector<uint8_t>> create_sync_packets(int p_count) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(42);
+
+	Vector<Vector2> positions;
+	positions.resize(16);
+	Vector<Vector<uint8_t>> packets;
+	for (int i = 0; i < p_count; i++) {
+		Ref<StreamPeerBuffer> spb;
+		spb.instantiate();
+		spb->put_u8(2); // Command.
+		spb->put_u32(i); // Time.
+		for (int j = 0; j < positions.size(); j++) {
+			positions.write[j] += Vector2(rng->randf_range(-1, 1), rng->randf_range(-1, 1));
+			spb->put_u32(j + 1); // Node ID.
+			spb->put_var(positions[j]);
+			spb->put_var(vformat("Player%d", j));
+			spb->put_var(100);
+		}
+		packets.push_back(spb->get_data_array());
+	}
+	return packets;
+}
+
+void check_round_trip(const Ref<PacketPeerZSTD> &p_receiver, const Vector<Vector<uint8_t>> &p_packets) {
+	for (const Vector<uint8_t> &packet : p_packets) {
+		REQUIRE(p_receiver->get_available_packet_count() > 0);
+		const uint8_t *data = nullptr;
+		int size = 0;
+		CHECK_EQ(p_receiver->get_packet(&data, size), OK);
+		REQUIRE_EQ(size, packet.size());
+		CHECK(memcmp(data, packet.ptr(), size) == 0);
+	}
+	CHECK_EQ(p_receiver->get_available_packet_count(), 0);
+}
+
+TEST_CASE("[PacketPeer][PacketPeerZSTD] Send and receive packets") {
+	Vector<Vector<uint8_t>> packets;
+	packets.push_back(Vector<uint8_t>());
+
+	Vector<uint8_t> small;
+	small.push_back(42);
+	packets.push_back(small);
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(0);
+	Vector<uint8_t> random;
+	random.resize(1000);
+	for (int i = 0; i < random.size(); i++) {
+		random.write[i] = rng->randi() % 256;
+	}
+	packets.push_back(random);
+
+	Vector<uint8_t> large;
+	large.resize(300000);
+	for (int i = 0; i < large.size(); i++) {
+		large.write[i] = i % 100;
+	}
+	packets.push_back(large);
+	packets.append_array(create_sync_packets(10));
+
+	SUBCASE("Independent packets") {
+		Ref<StreamPeerBuffer> spb;
+		spb.instantiate();
+		Ref<PacketPeerZSTD> sender = create_peer(spb, false);
+		for (const Vector<uint8_t> &packet : packets) {
+			CHECK_EQ(sender->put_packet(packet.ptr(), packet.size()), OK);
+		}
+		spb->seek(0);
+		check_round_trip(create_peer(spb, false), packets);
+	}
+
+	SUBCASE("Streaming") {
+		Ref<StreamPeerBuffer> spb;
+		spb.instantiate();
+		Ref<PacketPeerZSTD> sender = create_peer(spb, true);
+		for (const Vector<uint8_t> &packet : packets) {
+			CHECK_EQ(sender->put_packet(packet.ptr(), packet.size()), OK);
+		}
+		spb->seek(0);
+		check_round_trip(create_peer(spb, true), packets);
+	}
+
+	SUBCASE("Dictionary") {
+		// A recorded packet is a good raw content dictionary for the following ones.
+		const Vector<uint8_t> dictionary = create_sync_packets(1)[0];
+		Ref<StreamPeerBuffer> spb;
+		spb.instantiate();
+		Ref<PacketPeerZSTD> sender = create_peer(spb, false, dictionary);
+		for (const Vector<uint8_t> &packet : packets) {
+			CHECK_EQ(sender->put_packet(packet.ptr(), packet.size()), OK);
+		}
+		spb->seek(0);
+		check_round_trip(create_peer(spb, false, dictionary), packets);
+	}
+}
+
+TEST_CASE("[PacketPeer][PacketPeerZSTD] Compression ratio of synchronization traffic") {
+	const Vector<Vector<uint8_t>> packets = create_sync_packets(200);
+	const Vector<uint8_t> dictionary = create_sync_packets(1)[0];
+
+	int raw_size = 0;
+	for (const Vector<uint8_t> &packet : packets) {
+		raw_size += packet.size() + 4; // PacketPeerStream adds the packet size.
+	}
+
+	auto compressed_size = [&](bool p_streaming, const Vector<uint8_t> &p_dictionary) {
+		Ref<StreamPeerBuffer> spb;
+		spb.instantiate();
+		Ref<PacketPeerZSTD> sender = create_peer(spb, p_streaming, p_dictionary);
+		for (const Vector<uint8_t> &packet : packets) {
+			sender->put_packet(packet.ptr(), packet.size());
+		}
+		return spb->get_size();
+	};
+
+	const int independent_size = compressed_size(false, Vector<uint8_t>());
+	const int dictionary_size = compressed_size(false, dictionary);
+	const int streaming_size = compressed_size(true, Vector<uint8_t>());
+
+	CHECK_MESSAGE(independent_size < raw_size, "Packets should be compressed.");
+	// Positions are noisy, but the rest of the packet is the same every time.
+	CHECK_MESSAGE(dictionary_size < independent_size * 3 / 4, "A dictionary should help with small packets.");
+	CHECK_MESSAGE(streaming_size < independent_size * 3 / 4, "Previous packets should help when streaming.");
+}
+
+TEST_CASE("[PacketPeer][PacketPeerZSTD] Invalid packets") {
+	Ref<StreamPeerBuffer> spb;
+	spb.instantiate();
+	Ref<PacketPeerStream> pps;
+	pps.instantiate();
+	pps->set_stream_peer(spb);
+
+	const uint8_t unknown_type[] = { 7, 1, 2, 3 };
+	pps->put_packet(unknown_type, 4);
+	const uint8_t bad_frame[] = { 1, 0xFF, 0xFF, 0xFF, 0xFF };
+	pps->put_packet(bad_frame, 5);
+	spb->seek(0);
+
+	Ref<PacketPeerZSTD> receiver = create_peer(spb, false);
+	const uint8_t *data = nullptr;
+	int size = 0;
+	ERR_PRINT_OFF;
+	CHECK_EQ(receiver->get_packet(&data, size), ERR_INVALID_DATA);
+	CHECK_EQ(receiver->get_packet(&data, size), ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
+} // namespace TestPacketPeerZSTD
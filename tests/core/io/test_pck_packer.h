@@ -32,6 +32,7 @@
 
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
+#include "core/math/random_pcg.h"
 #include "core/os/os.h"
 
 #include "tests/test_utils.h"
@@ -61,6 +62,10 @@ TEST_CASE("[PCKPacker] Pack an empty PCK file") {
 	CHECK_MESSAGE(
 			f->get_length() <= 500,
 			"The generated empty PCK file shouldn't be too large.");
+	f->seek(4);
+	CHECK_MESSAGE(
+			f->get_32() == PACK_FORMAT_VERSION_UNCOMPRESSED,
+			"A PCK file without compressed files should keep the previous format version.");
 }
 
 TEST_CASE("[PCKPacker] Pack empty with zero alignment invalid") {
@@ -116,4 +121,137 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Compressed files are read back") {
+	// Large enough to span many compressed blocks.
+	Vector<uint8_t> compressible;
+	compressible.resize(PACK_COMPRESSED_BLOCK_SIZE * 9 + 1234);
+	for (int i = 0; i < compressible.size(); i++) {
+		compressible.write[i] = (i / 7) % 61;
+	}
+	Vector<uint8_t> incompressible;
+	incompressible.resize(5000);
+	RandomPCG rng(1234);
+	for (int i = 0; i < incompressible.size(); i++) {
+		incompressible.write[i] = rng.rand() % 256;
+	}
+
+	const String compressible_path = TestUtils::get_temp_path("compressible.bin");
+	const String incompressible_path = TestUtils::get_temp_path("incompressible.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(compressible_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(compressible);
+		f = FileAccess::open(incompressible_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(incompressible);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK(pck_packer.add_file_compressed("compressible.bin", compressible_path) == OK);
+	CHECK(pck_packer.add_file_compressed("incompressible.bin", incompressible_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+	{
+		Ref<FileAccess> pck = FileAccess::open(output_pck_path, FileAccess::READ);
+		CHECK_MESSAGE(
+				pck->get_length() < uint64_t(compressible.size() / 2),
+				"The compressible file should be stored compressed.");
+		pck->seek(4);
+		CHECK(pck->get_32() == PACK_FORMAT_VERSION);
+	}
+
+	PackedData *packed_data = PackedData::get_singleton() ? nullptr : memnew(PackedData);
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+
+	Ref<FileAccess> f = PackedData::get_singleton()->try_open_path("res://compressible.bin");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == uint64_t(compressible.size()));
+	Vector<uint8_t> read;
+	read.resize(compressible.size());
+	// Ends on a block boundary, with the blocks after the first decompressed straight into the buffer.
+	const int first_part = PACK_COMPRESSED_BLOCK_SIZE * 9;
+	CHECK(f->get_buffer(read.ptrw(), first_part) == uint64_t(first_part));
+	CHECK(f->get_buffer(read.ptrw() + first_part, compressible.size() - first_part) == uint64_t(compressible.size() - first_part));
+	CHECK(read == compressible);
+
+	// Seeking back into the block left loaded, then into an earlier one.
+	f->seek(PACK_COMPRESSED_BLOCK_SIZE * 8 + 5);
+	CHECK(f->get_8() == compressible[PACK_COMPRESSED_BLOCK_SIZE * 8 + 5]);
+	f->seek(PACK_COMPRESSED_BLOCK_SIZE * 3 - 2);
+	uint8_t across_blocks[4];
+	CHECK(f->get_buffer(across_blocks, 4) == 4);
+	CHECK(memcmp(across_blocks, compressible.ptr() + PACK_COMPRESSED_BLOCK_SIZE * 3 - 2, 4) == 0);
+
+	f = PackedData::get_singleton()->try_open_path("res://incompressible.bin");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_buffer(incompressible.size()) == incompressible);
+
+	f.unref();
+	PackedData::get_singleton()->clear();
+	if (packed_data) {
+		memdelete(packed_data);
+	}
+}
+
+TEST_CASE("[PCKPacker] Buffer views of packed files share the pack mapping") {
+	Vector<uint8_t> contents;
+	contents.resize(3000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = i % 251;
+	}
+	const String file_path = TestUtils::get_temp_path("viewed.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(contents);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_views.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK(pck_packer.add_file("a.bin", file_path) == OK);
+	CHECK(pck_packer.add_file("b.bin", file_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton() ? nullptr : memnew(PackedData);
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+
+	Ref<FileAccess> a = PackedData::get_singleton()->try_open_path("res://a.bin");
+	Ref<FileAccess> a_again = PackedData::get_singleton()->try_open_path("res://a.bin");
+	Ref<FileAccess> b = PackedData::get_singleton()->try_open_path("res://b.bin");
+	REQUIRE(a.is_valid());
+	REQUIRE(a_again.is_valid());
+	REQUIRE(b.is_valid());
+	a->seek(10);
+	const uint8_t *view = a->get_buffer_view(100);
+	if (view) {
+		CHECK(memcmp(view, contents.ptr() + 10, 100) == 0);
+		CHECK(a->get_position() == 110);
+		CHECK(a->get_8() == contents[110]);
+		// Views of the same pack point into a single mapping.
+		a_again->seek(10);
+		CHECK(a_again->get_buffer_view(100) == view);
+		const uint8_t *view_b = b->get_buffer_view(contents.size());
+		REQUIRE(view_b != nullptr);
+		CHECK(memcmp(view_b, contents.ptr(), contents.size()) == 0);
+		CHECK(b->eof_reached() == false);
+		CHECK(b->get_position() == uint64_t(contents.size()));
+	} else {
+		CHECK(a->get_position() == 10);
+	}
+	// Views past the end of the packed file are refused, even though the pack goes on.
+	a->seek(contents.size() - 4);
+	CHECK(a->get_buffer_view(8) == nullptr);
+	CHECK(a->get_position() == uint64_t(contents.size() - 4));
+
+	a.unref();
+	a_again.unref();
+	b.unref();
+	PackedData::get_singleton()->clear();
+	if (packed_data) {
+		memdelete(packed_data);
+	}
+}
 } // namespace TestPCKPacker
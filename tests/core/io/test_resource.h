@@ -31,14 +31,23 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
 #include "tests/test_macros.h"
 
+class TestResourceLoaderBinaryAccessor {
+public:
+	// Number of loads which decoded their resources on worker threads.
+	static uint64_t get_parallel_decode_count() { return ResourceLoaderBinary::parallel_decode_count.get(); }
+	static void set_parallel_decode_disabled(bool p_disabled) { ResourceLoaderBinary::parallel_decode_disabled = p_disabled; }
+};
+
 namespace TestResource {
 
 TEST_CASE("[Resource] Duplication") {
@@ -111,6 +120,126 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+struct LoadTask {
+	String path;
+	Ref<Resource> resource;
+};
+
+static void _load_task(void *p_userdata) {
+	LoadTask *load_task = (LoadTask *)p_userdata;
+	load_task->resource = ResourceLoader::load(load_task->path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+}
+
+TEST_CASE("[Resource] Loading many sub-resources") {
+	// Enough sub-resources for them to be decoded on worker threads, linked in order afterwards.
+	const int count = 200;
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("values", PackedInt32Array({ i, i * 2 }));
+		if (i > 0) {
+			child->set_meta("previous", children[i - 1]);
+		}
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+	const String save_path_binary = TestUtils::get_temp_path("many_resources.res");
+	REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+
+	const uint64_t parallel_decodes = TestResourceLoaderBinaryAccessor::get_parallel_decode_count();
+	Ref<Resource> loaded_resource;
+	SUBCASE("On the calling thread") {
+		loaded_resource = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	}
+	SUBCASE("On a worker thread") {
+		// Like threaded loads, which must not block worker threads while decoding.
+		LoadTask load_task{ save_path_binary };
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&_load_task, &load_task, true);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		loaded_resource = load_task.resource;
+	}
+	REQUIRE(loaded_resource.is_valid());
+	if (WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		CHECK_MESSAGE(
+				TestResourceLoaderBinaryAccessor::get_parallel_decode_count() == parallel_decodes + 1,
+				"The sub-resources should have been decoded on worker threads.");
+	}
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == count);
+	for (int i = 0; i < count; i++) {
+		const Ref<Resource> child = loaded_children[i];
+		REQUIRE(child.is_valid());
+		CHECK(child->get_name() == vformat("Child %d", i));
+		CHECK(child->get_meta("values") == Variant(PackedInt32Array({ i, i * 2 })));
+		if (i > 0) {
+			CHECK_MESSAGE(
+					Ref<Resource>(child->get_meta("previous")) == loaded_children[i - 1],
+					"References between sub-resources should point to the loaded instances.");
+		}
+	}
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][Resource] Loading many sub-resources in parallel compared to sequentially") {
+	const int count = 5000;
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		PackedFloat32Array values;
+		values.resize(256);
+		values.fill(i);
+		child->set_meta("values", values);
+		child->set_meta("dictionary", Dictionary({ { "index", i }, { "name", child->get_name() } }));
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+	const String save_path_binary = TestUtils::get_temp_path("benchmark_resources.res");
+	REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+
+	const int iterations = 10;
+	uint64_t usec[2] = {};
+	for (int parallel = 0; parallel < 2; parallel++) {
+		TestResourceLoaderBinaryAccessor::set_parallel_decode_disabled(parallel == 0);
+		const uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < iterations; i++) {
+			const Ref<Resource> loaded = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+			REQUIRE(loaded.is_valid());
+			CHECK(Array(loaded->get_meta("children")).size() == count);
+		}
+		usec[parallel] = OS::get_singleton()->get_ticks_usec() - start;
+	}
+	TestResourceLoaderBinaryAccessor::set_parallel_decode_disabled(false);
+
+	print_line(vformat("Loading %d sub-resources with %d worker threads: sequential %d ms, parallel %d ms.", count, WorkerThreadPool::get_singleton()->get_thread_count(), usec[0] / 1000 / iterations, usec[1] / 1000 / iterations));
+}
+
+TEST_CASE("[Resource] Loading external dependencies") {
+	const String dependency_path = TestUtils::get_temp_path("dependency.res");
+	const String save_path_binary = TestUtils::get_temp_path("dependent.res");
+	{
+		Ref<Resource> dependency = memnew(Resource);
+		dependency->set_name("Dependency");
+		REQUIRE(ResourceSaver::save(dependency, dependency_path) == OK);
+		dependency->set_path(dependency_path);
+
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_meta("dependency", dependency);
+		REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+	}
+	// Neither is cached anymore, so the dependency gets read ahead while loading.
+	REQUIRE_FALSE(ResourceCache::has(dependency_path));
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	const Ref<Resource> loaded_dependency = loaded_resource->get_meta("dependency");
+	REQUIRE(loaded_dependency.is_valid());
+	CHECK(loaded_dependency->get_name() == "Dependency");
+	CHECK(loaded_dependency->get_path() == dependency_path);
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
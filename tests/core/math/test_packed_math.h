@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  test_packed_math.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/math/packed_math.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedMath {
+
+TEST_CASE("[PackedMath] Element-wise operations on floats") {
+	PackedFloat32Array array = { 1, 2, 3, 4 };
+	PackedMath::multiply_add(array.ptrw(), array.size(), 2.0f, 1.0f);
+	CHECK(array == PackedFloat32Array({ 3, 5, 7, 9 }));
+
+	const PackedFloat32Array values = { 1, 1, 2, 2 };
+	PackedMath::add(array.ptrw(), values.ptr(), array.size());
+	CHECK(array == PackedFloat32Array({ 4, 6, 9, 11 }));
+	PackedMath::multiply(array.ptrw(), values.ptr(), array.size());
+	CHECK(array == PackedFloat32Array({ 4, 6, 18, 22 }));
+
+	PackedMath::clamp(array.ptrw(), array.size(), 5.0f, 20.0f);
+	CHECK(array == PackedFloat32Array({ 5, 6, 18, 20 }));
+
+	const PackedFloat32Array to = { 15, 16, 28, 30 };
+	PackedMath::lerp(array.ptrw(), to.ptr(), array.size(), 0.5f);
+	CHECK(array == PackedFloat32Array({ 10, 11, 23, 25 }));
+}
+
+TEST_CASE("[PackedMath] Reductions") {
+	const PackedFloat64Array array = { 3, -1, 7, 2 };
+	CHECK(PackedMath::sum(array.ptr(), array.size()) == doctest::Approx(11.0));
+	CHECK(PackedMath::min(array.ptr(), array.size()) == -1.0);
+	CHECK(PackedMath::max(array.ptr(), array.size()) == 7.0);
+
+	const PackedVector3Array vectors = { Vector3(1, 5, -2), Vector3(3, -4, 0) };
+	CHECK(PackedMath::sum(vectors.ptr(), vectors.size()).is_equal_approx(Vector3(4, 1, -2)));
+	CHECK(PackedMath::min(vectors.ptr(), vectors.size()) == Vector3(1, -4, -2));
+	CHECK(PackedMath::max(vectors.ptr(), vectors.size()) == Vector3(3, 5, 0));
+
+	const PackedFloat32Array empty;
+	CHECK(PackedMath::sum(empty.ptr(), empty.size()) == 0.0f);
+	CHECK(PackedMath::max(empty.ptr(), empty.size()) == 0.0f);
+}
+
+TEST_CASE("[PackedMath] Transform and colors") {
+	PackedVector3Array vectors = { Vector3(1, 0, 0), Vector3(0, 1, 0) };
+	const Transform3D xform = Transform3D(Basis().scaled(Vector3(2, 2, 2)), Vector3(0, 0, 1));
+	PackedMath::transform(vectors.ptrw(), vectors.size(), xform);
+	CHECK(vectors[0].is_equal_approx(Vector3(2, 0, 1)));
+	CHECK(vectors[1].is_equal_approx(Vector3(0, 2, 1)));
+
+	PackedColorArray colors = { Color(0.5, 0.5, 0.5, 1), Color(1, 0, 0, 1) };
+	PackedMath::multiply_add(colors.ptrw(), colors.size(), Color(2, 2, 2, 1), Color(0, 0, 0, 0));
+	PackedMath::clamp(colors.ptrw(), colors.size(), Color(0, 0, 0, 0), Color(1, 1, 1, 1));
+	CHECK(colors[0].is_equal_approx(Color(1, 1, 1, 1)));
+	CHECK(colors[1].is_equal_approx(Color(1, 0, 0, 1)));
+}
+
+TEST_CASE("[PackedMath] Large arrays match the per-element result") {
+	const int size = 300000; // Several chunks, possibly processed in parallel.
+	PackedFloat32Array array;
+	array.resize(size);
+	float *w = array.ptrw();
+	for (int i = 0; i < size; i++) {
+		w[i] = i % 100;
+	}
+
+	PackedMath::multiply_add(array.ptrw(), size, 0.5f, 1.0f);
+	bool all_match = true;
+	for (int i = 0; i < size; i++) {
+		all_match = all_match && array[i] == (i % 100) * 0.5f + 1.0f;
+	}
+	CHECK(all_match);
+	CHECK(PackedMath::min(array.ptr(), size) == 1.0f);
+	CHECK(PackedMath::max(array.ptr(), size) == 50.5f);
+	CHECK(PackedMath::sum(array.ptr(), size) == doctest::Approx(size * 25.75f));
+}
+
+TEST_CASE("[PackedMath] Bound methods") {
+	Variant array = PackedFloat32Array({ 1, 2, 3 });
+	Callable::CallError ce;
+	Variant ret;
+
+	const Variant multiplier = 2.0;
+	const Variant addend = 0.5;
+	const Variant *args[2] = { &multiplier, &addend };
+	array.callp("multiply_add", args, 2, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(PackedFloat32Array(array) == PackedFloat32Array({ 2.5, 4.5, 6.5 }));
+
+	array.callp("sum", nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(double(ret) == doctest::Approx(13.5));
+
+	const Variant other = PackedFloat32Array({ 1, 2 });
+	const Variant *add_args[1] = { &other };
+	ERR_PRINT_OFF;
+	array.callp("add_elements", add_args, 1, ret, ce);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(PackedFloat32Array(array) == PackedFloat32Array({ 2.5, 4.5, 6.5 }), "Mismatched sizes should leave the array untouched.");
+}
+
+} // namespace TestPackedMath
@@ -898,4 +898,90 @@ TEST_SUITE("[ClassDB]") {
 		}
 	}
 }
+
+class _TestFrozenClassDBObject : public RefCounted {
+	GDCLASS(_TestFrozenClassDBObject, RefCounted);
+
+	int value = 0;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestFrozenClassDBObject::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestFrozenClassDBObject::get_value);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "value"), "set_value", "get_value");
+	}
+
+public:
+	void set_value(int p_value) { value = p_value; }
+	int get_value() const { return value; }
+	int get_value_doubled() const { return value * 2; }
+};
+
+// Restores the frozen state on scope exit, so it doesn't leak into other tests.
+struct _ScopedClassDBFreeze {
+	bool was_frozen = ClassDB::is_frozen();
+
+	_ScopedClassDBFreeze() { ClassDB::freeze(); }
+	~_ScopedClassDBFreeze() {
+		if (!was_frozen) {
+			ClassDB::unfreeze();
+		}
+	}
+};
+
+TEST_CASE("[ClassDB] Lookups once frozen") {
+	_ScopedClassDBFreeze freeze;
+	CHECK(ClassDB::is_frozen());
+
+	CHECK(ClassDB::get_method("RefCounted", "get_reference_count") != nullptr);
+	CHECK(ClassDB::get_method("RefCounted", "get_class") == ClassDB::get_method("Object", "get_class"));
+	CHECK(ClassDB::get_method("RefCounted", "nonexistent_method") == nullptr);
+	CHECK(ClassDB::has_method("RefCounted", "get_class"));
+	CHECK_FALSE(ClassDB::has_method("RefCounted", "get_class", true));
+	CHECK_FALSE(ClassDB::has_method("RefCounted", "nonexistent_method"));
+
+	SUBCASE("Classes registered after freezing") {
+		GDREGISTER_CLASS(_TestFrozenClassDBObject);
+		CHECK(ClassDB::has_method("_TestFrozenClassDBObject", "get_value"));
+		CHECK(ClassDB::has_method("_TestFrozenClassDBObject", "get_reference_count"));
+		CHECK_FALSE(ClassDB::has_method("RefCounted", "get_value"));
+
+		Ref<_TestFrozenClassDBObject> object;
+		object.instantiate();
+		bool valid = false;
+		CHECK(ClassDB::set_property(object.ptr(), "value", 21, &valid));
+		CHECK(valid);
+		CHECK(object->get_value() == 21);
+		Variant value;
+		CHECK(ClassDB::get_property(object.ptr(), "value", value));
+		CHECK(value == Variant(21));
+		CHECK_FALSE(ClassDB::set_property(object.ptr(), "nonexistent_property", 1));
+		CHECK_FALSE(ClassDB::get_property(object.ptr(), "nonexistent_property", value));
+	}
+
+	SUBCASE("Methods bound after the tables were built") {
+		GDREGISTER_CLASS(_TestFrozenClassDBObject);
+		if (!ClassDB::has_method("_TestFrozenClassDBObject", "get_value_doubled")) {
+			ClassDB::bind_method(D_METHOD("get_value_doubled"), &_TestFrozenClassDBObject::get_value_doubled);
+		}
+		MethodBind *method = ClassDB::get_method("_TestFrozenClassDBObject", "get_value_doubled");
+		REQUIRE(method != nullptr);
+
+		Ref<_TestFrozenClassDBObject> object;
+		object.instantiate();
+		object->set_value(4);
+		Callable::CallError ce;
+		CHECK(method->call(object.ptr(), nullptr, 0, ce) == Variant(8));
+	}
+}
+
+TEST_CASE("[ClassDB] Unfreezing restores hierarchy lookups") {
+	{
+		_ScopedClassDBFreeze freeze;
+		CHECK(ClassDB::get_method("RefCounted", "get_class") != nullptr);
+	}
+	CHECK_FALSE(ClassDB::is_frozen());
+	CHECK(ClassDB::get_method("RefCounted", "get_class") == ClassDB::get_method("Object", "get_class"));
+	CHECK(ClassDB::has_method("RefCounted", "get_reference_count"));
+}
 } // namespace TestClassDB
@@ -169,4 +169,57 @@ TEST_CASE("[MethodBind] check all method binds") {
 
 	memdelete(mbt);
 }
+
+class PackedArrayPtrcallTester : public Object {
+	GDCLASS(PackedArrayPtrcallTester, Object);
+
+public:
+	const PackedByteArray *received = nullptr;
+
+	void take_array(const PackedByteArray &p_array) {
+		received = &p_array;
+	}
+
+	PackedByteArray make_array(int p_size) {
+		PackedByteArray ret;
+		ret.resize(p_size);
+		return ret;
+	}
+
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("take_array", "array"), &PackedArrayPtrcallTester::take_array);
+		ClassDB::bind_method(D_METHOD("make_array", "size"), &PackedArrayPtrcallTester::make_array);
+	}
+};
+
+TEST_CASE("[MethodBind] Packed arrays are passed through ptrcall without copies") {
+	GDREGISTER_CLASS(PackedArrayPtrcallTester);
+	PackedArrayPtrcallTester *tester = memnew(PackedArrayPtrcallTester);
+
+	MethodBind *take = ClassDB::get_method("PackedArrayPtrcallTester", "take_array");
+	REQUIRE(take);
+	PackedByteArray array = { 1, 2, 3 };
+	const void *take_args[1] = { &array };
+	take->ptrcall(tester, take_args, nullptr);
+	CHECK_MESSAGE(tester->received == &array, "Const reference arguments should refer to the caller's array.");
+
+	MethodBind *make = ClassDB::get_method("PackedArrayPtrcallTester", "make_array");
+	REQUIRE(make);
+	int64_t size = 16;
+	const void *make_args[1] = { &size };
+	PackedByteArray ret;
+	make->ptrcall(tester, make_args, &ret);
+	CHECK(ret.size() == 16);
+
+	// Return values are moved into the return slot, leaving nothing behind to release.
+	PackedByteArray returned = { 4, 5, 6 };
+	const uint8_t *returned_data = returned.ptr();
+	PackedByteArray slot;
+	PtrToArg<PackedByteArray>::encode(std::move(returned), &slot);
+	CHECK_MESSAGE(returned.is_empty(), "The returned array should have been moved out.");
+	CHECK(slot.ptr() == returned_data);
+
+	memdelete(tester);
+}
+
 } // namespace TestMethodBind
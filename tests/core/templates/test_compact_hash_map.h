@@ -0,0 +1,365 @@
+/**************************************************************************/
+/*  test_compact_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/templates/compact_hash_map.h"
+#include "core/templates/hash_map.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompactHashMap {
+
+TEST_CASE("[CompactHashMap] List initialization") {
+	CompactHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[CompactHashMap] Insert element") {
+	CompactHashMap<int, int> map;
+	CompactHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[CompactHashMap] Overwrite element") {
+	CompactHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[CompactHashMap] Erase") {
+	CompactHashMap<int, int> map;
+	CompactHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(43, 85);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.erase(43));
+	CHECK(!map.erase(43));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[CompactHashMap] Inline storage") {
+	CompactHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	for (int i = 0; i < 4; i++) {
+		map.insert(i, i);
+	}
+	CHECK(map.is_inline());
+
+	// Reusing the holes left by erased elements should not leave inline mode.
+	map.erase(0);
+	map.erase(2);
+	map.insert(4, 4);
+	map.insert(5, 5);
+	CHECK(map.is_inline());
+	CHECK(map.size() == 4);
+
+	map.insert(6, 6);
+	CHECK(!map.is_inline());
+	CHECK(map.size() == 5);
+
+	Vector<int> expected = { 1, 3, 4, 5, 6 };
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[idx]);
+		CHECK(E.value == expected[idx]);
+		idx++;
+	}
+
+	map.reset();
+	CHECK(map.is_inline());
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[CompactHashMap] Erase preserves insertion order") {
+	CompactHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+	}
+	for (int i = 0; i < 100; i += 3) {
+		map.erase(i);
+	}
+	// Re-inserted keys go to the end.
+	map.insert(0, -1);
+
+	int prev = -1;
+	for (const KeyValue<int, int> &E : map) {
+		if (E.key == 0) {
+			CHECK(E.value == -1);
+			break;
+		}
+		CHECK(E.key % 3 != 0);
+		CHECK(E.key > prev);
+		CHECK(E.value == E.key * 2);
+		prev = E.key;
+	}
+	CHECK(prev == 98);
+	CHECK(map.size() == 67);
+}
+
+TEST_CASE("[CompactHashMap] Iterator increment skips erased elements") {
+	CompactHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i);
+	}
+	map.erase(5);
+	map.erase(6);
+
+	CompactHashMap<int, int>::Iterator it = map.find(4);
+	++it;
+	CHECK(it->key == 7);
+
+	map.erase(9);
+	it = map.find(8);
+	++it;
+	CHECK(!it);
+}
+
+TEST_CASE("[CompactHashMap] Clear") {
+	CompactHashMap<int, int> map;
+	for (int i = 0; i < 20; i++) {
+		map.insert(i, i);
+	}
+
+	map.clear();
+	CHECK(!map.has(0));
+	CHECK(map.size() == 0);
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+
+	map.insert(1, 2);
+	CHECK(map[1] == 2);
+}
+
+TEST_CASE("[CompactHashMap] Get") {
+	CompactHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+
+	CHECK(map.get(123) == 12385);
+	map.get(123) = 10;
+	CHECK(map.get(123) == 10);
+
+	CHECK(*map.getptr(0) == 12934);
+	*map.getptr(0) = 1;
+	CHECK(*map.getptr(0) == 1);
+
+	CHECK(map.get(42) == 84);
+	CHECK(map.getptr(-10) == nullptr);
+}
+
+TEST_CASE("[CompactHashMap] Sort") {
+	CompactHashMap<int, int> map;
+	map.insert(5, 0);
+	map.insert(1, 1);
+	map.insert(9, 2);
+	map.insert(3, 3);
+	map.insert(7, 4);
+	map.insert(2, 5);
+	map.erase(9);
+	map.sort();
+
+	Vector<int> expected = { 1, 2, 3, 5, 7 };
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[idx]);
+		idx++;
+	}
+	CHECK(map[5] == 0);
+	CHECK(map[2] == 5);
+	CHECK(!map.has(9));
+}
+
+TEST_CASE("[CompactHashMap] Insert, iterate and remove many strings") {
+	const int elem_max = 432;
+	CompactHashMap<String, String> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(itos(i), itos(i));
+	}
+
+	// Insert order should have been kept.
+	int idx = 0;
+	for (const KeyValue<String, String> &E : map) {
+		CHECK(itos(idx) == E.key);
+		CHECK(itos(idx) == E.value);
+		idx++;
+	}
+
+	Vector<String> elems_still_valid;
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			map.erase(itos(i));
+		} else {
+			elems_still_valid.push_back(itos(i));
+		}
+	}
+
+	CHECK(elems_still_valid.size() == (int)map.size());
+
+	idx = 0;
+	for (const KeyValue<String, String> &E : map) {
+		CHECK(elems_still_valid[idx] == E.key);
+		idx++;
+	}
+}
+
+TEST_CASE("[CompactHashMap] Copy constructor and operator =") {
+	CompactHashMap<int, int> map0;
+	for (int i = 0; i < 50; i++) {
+		map0.insert(i, i);
+	}
+	for (int i = 0; i < 50; i += 2) {
+		map0.erase(i);
+	}
+
+	CompactHashMap<int, int> map1(map0);
+	CompactHashMap<int, int> map2;
+	map2.insert(1234, 1234);
+	map2 = map0;
+
+	CHECK(map1.size() == map0.size());
+	CHECK(map2.size() == map0.size());
+	CHECK(!map2.has(1234));
+
+	CompactHashMap<int, int>::Iterator it1 = map1.begin();
+	CompactHashMap<int, int>::Iterator it2 = map2.begin();
+	for (const KeyValue<int, int> &E : map0) {
+		CHECK(it1->key == E.key);
+		CHECK(it2->key == E.key);
+		++it1;
+		++it2;
+	}
+}
+
+TEST_CASE("[CompactHashMap] Elements keep their address") {
+	CompactHashMap<String, int> map;
+	map.insert("first", 1);
+	int *first = map.getptr("first");
+	const String *first_key = &map.find("first")->key;
+
+	for (int i = 0; i < 1000; i++) {
+		map.insert(itos(i), i);
+	}
+	for (int i = 0; i < 1000; i += 2) {
+		map.erase(itos(i));
+	}
+	// Reuses the erased slots and compacts the entries.
+	for (int i = 1000; i < 3000; i++) {
+		map.insert(itos(i), i);
+	}
+	map.sort();
+
+	CHECK(map.getptr("first") == first);
+	CHECK(&map.find("first")->key == first_key);
+	CHECK(*first == 1);
+	CHECK(map.size() == 2501);
+
+	// Assigning from an element to a new key must not read a moved value.
+	map["copy"] = map["2999"];
+	CHECK(map["copy"] == 2999);
+}
+
+template <typename TMap>
+static uint64_t _benchmark_small_maps(int p_maps, int p_size, int64_t &r_checksum) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_maps; i++) {
+		TMap map;
+		for (int j = 0; j < p_size; j++) {
+			map[Variant(j)] = Variant(i + j);
+		}
+		for (int j = 0; j < p_size; j++) {
+			r_checksum += (int64_t)*map.getptr(Variant(j));
+		}
+		for (const KeyValue<Variant, Variant> &E : map) {
+			r_checksum += (int64_t)E.key;
+		}
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+template <typename TMap>
+static uint64_t _benchmark_large_map(int p_size, int p_rounds, int64_t &r_checksum) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	TMap map;
+	for (int j = 0; j < p_size; j++) {
+		map[Variant(itos(j))] = Variant(j);
+	}
+	for (int round = 0; round < p_rounds; round++) {
+		for (int j = 0; j < p_size; j += 7) {
+			r_checksum += (int64_t)*map.getptr(Variant(itos(j)));
+		}
+		for (const KeyValue<Variant, Variant> &E : map) {
+			r_checksum += (int64_t)E.value;
+		}
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][CompactHashMap] Create, lookup and iterate compared to HashMap") {
+	typedef HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> VariantHashMap;
+	typedef CompactHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> VariantCompactHashMap;
+
+	for (int size : { 2, 4, 8, 16 }) {
+		int64_t hash_map_checksum = 0;
+		int64_t compact_checksum = 0;
+		const uint64_t hash_map_usec = _benchmark_small_maps<VariantHashMap>(200000, size, hash_map_checksum);
+		const uint64_t compact_usec = _benchmark_small_maps<VariantCompactHashMap>(200000, size, compact_checksum);
+		CHECK(hash_map_checksum == compact_checksum);
+		print_line(vformat("200000 maps of %d elements: HashMap %d ms, CompactHashMap %d ms.", size, hash_map_usec / 1000, compact_usec / 1000));
+	}
+
+	int64_t hash_map_checksum = 0;
+	int64_t compact_checksum = 0;
+	const uint64_t hash_map_usec = _benchmark_large_map<VariantHashMap>(100000, 20, hash_map_checksum);
+	const uint64_t compact_usec = _benchmark_large_map<VariantCompactHashMap>(100000, 20, compact_checksum);
+	CHECK(hash_map_checksum == compact_checksum);
+	print_line(vformat("One map of 100000 elements: HashMap %d ms, CompactHashMap %d ms.", hash_map_usec / 1000, compact_usec / 1000));
+}
+
+} // namespace TestCompactHashMap
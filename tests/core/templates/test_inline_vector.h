@@ -0,0 +1,199 @@
+/**************************************************************************/
+/*  test_inline_vector.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/templates/inline_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestInlineVector {
+
+TEST_CASE("[InlineVector] List initialization") {
+	InlineVector<int, 4> vector{ 0, 1, 2 };
+
+	CHECK(vector.size() == 3);
+	CHECK_FALSE(vector.is_spilled());
+	CHECK(vector[0] == 0);
+	CHECK(vector[1] == 1);
+	CHECK(vector[2] == 2);
+
+	InlineVector<int, 2> large{ 0, 1, 2, 3, 4 };
+	CHECK(large.size() == 5);
+	CHECK(large.is_spilled());
+	CHECK(large[4] == 4);
+}
+
+TEST_CASE("[InlineVector] Small vectors don't allocate") {
+	const uint64_t alloc_count = Memory::get_alloc_count();
+	InlineVector<String, 4> vector;
+	vector.push_back(String());
+	vector.push_back(String());
+	vector.insert(0, String());
+	CHECK(vector.size() == 3);
+	CHECK_FALSE(vector.is_spilled());
+	CHECK(Memory::get_alloc_count() == alloc_count);
+}
+
+TEST_CASE("[InlineVector] Spill to heap and back") {
+	InlineVector<int, 2> vector;
+	vector.push_back(1);
+	vector.push_back(2);
+	CHECK_FALSE(vector.is_spilled());
+
+	vector.push_back(3);
+	CHECK(vector.is_spilled());
+	CHECK(vector.size() == 3);
+	CHECK(vector[0] == 1);
+	CHECK(vector[1] == 2);
+	CHECK(vector[2] == 3);
+
+	vector.clear();
+	CHECK_FALSE(vector.is_spilled());
+	CHECK(vector.is_empty());
+
+	vector.push_back(4);
+	CHECK(vector.size() == 1);
+	CHECK(vector[0] == 4);
+}
+
+TEST_CASE("[InlineVector] Insert, remove and find") {
+	InlineVector<int, 3> vector{ 0, 2 };
+	CHECK(vector.insert(1, 1) == OK);
+	CHECK(vector.insert(3, 3) == OK);
+	ERR_PRINT_OFF;
+	CHECK(vector.insert(6, 6) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+	CHECK(vector.size() == 4);
+	for (int i = 0; i < 4; i++) {
+		CHECK(vector[i] == i);
+	}
+
+	CHECK(vector.find(2) == 2);
+	CHECK(vector.find(2, 3) == -1);
+	CHECK(vector.has(3));
+
+	vector.remove_at(0);
+	CHECK(vector.size() == 3);
+	CHECK(vector[0] == 1);
+	CHECK(vector.erase(3));
+	CHECK_FALSE(vector.erase(3));
+	CHECK(vector.size() == 2);
+	CHECK(vector[1] == 2);
+}
+
+TEST_CASE("[InlineVector] Fill, reverse and sort") {
+	InlineVector<int, 4> vector{ 3, 1, 2 };
+	vector.reverse();
+	CHECK(vector[0] == 2);
+	CHECK(vector[1] == 1);
+	CHECK(vector[2] == 3);
+
+	vector.sort_custom<_DefaultComparator<int>>();
+	CHECK(vector[0] == 1);
+	CHECK(vector[1] == 2);
+	CHECK(vector[2] == 3);
+	CHECK(vector.bsearch_custom<_DefaultComparator<int>>(2, true) == 1);
+
+	vector.fill(7);
+	CHECK(vector[0] == 7);
+	CHECK(vector[2] == 7);
+}
+
+TEST_CASE("[InlineVector] Copy and conversion") {
+	InlineVector<String, 2> small{ "a", "b" };
+	InlineVector<String, 2> small_copy = small;
+	small_copy.write[0] = "c";
+	CHECK(small[0] == "a");
+	CHECK(small_copy[0] == "c");
+
+	InlineVector<String, 2> large{ "a", "b", "c" };
+	InlineVector<String, 2> large_copy = large;
+	large_copy.write[0] = "d";
+	CHECK(large[0] == "a");
+	CHECK(large_copy[0] == "d");
+
+	Vector<String> vector = large;
+	CHECK(vector.size() == 3);
+	CHECK(vector[2] == "c");
+
+	InlineVector<String, 2> from_vector = vector;
+	CHECK(from_vector.is_spilled());
+	CHECK(from_vector.size() == 3);
+
+	small_copy = Vector<String>({ "x" });
+	CHECK_FALSE(small_copy.is_spilled());
+	CHECK(small_copy.size() == 1);
+	CHECK(small_copy[0] == "x");
+
+	small_copy.append_array(large);
+	CHECK(small_copy.size() == 4);
+	CHECK(small_copy[3] == "c");
+}
+
+struct TreeNode {
+	String name;
+	// Held through a Vector, inline storage can't nest the type in itself.
+	Vector<InlineVector<TreeNode, 2>> children;
+};
+
+TEST_CASE("[InlineVector] Assign from a vector owned by the destination") {
+	InlineVector<TreeNode, 2> tree;
+	tree.push_back(TreeNode());
+	InlineVector<TreeNode, 2> children;
+	children.push_back(TreeNode{ "a", {} });
+	children.push_back(TreeNode{ "b", {} });
+	tree.write[0].children.push_back(children);
+	children.clear();
+
+	// Clearing the destination destroys the source, so it must be copied first.
+	tree = tree[0].children[0];
+	REQUIRE(tree.size() == 2);
+	CHECK(tree[0].name == "a");
+	CHECK(tree[1].name == "b");
+
+	InlineVector<TreeNode, 2> spilled_tree;
+	spilled_tree.push_back(TreeNode());
+	for (int i = 0; i < 3; i++) {
+		children.push_back(TreeNode{ itos(i), {} });
+	}
+	spilled_tree.write[0].children.push_back(children);
+	children.clear();
+	spilled_tree = spilled_tree[0].children[0];
+	REQUIRE(spilled_tree.size() == 3);
+	CHECK(spilled_tree[2].name == "2");
+
+	InlineVector<TreeNode, 2> moved_to(std::move(spilled_tree));
+	CHECK(spilled_tree.is_empty());
+	CHECK(moved_to.size() == 3);
+}
+
+} // namespace TestInlineVector
@@ -108,6 +108,24 @@ TEST_CASE("[Array] resize(), insert(), and erase()") {
 	CHECK(int(arr[0]) == 1);
 }
 
+TEST_CASE("[Array] Small arrays don't allocate element storage") {
+	Array arr;
+	const uint64_t alloc_count = Memory::get_alloc_count();
+	arr.push_back(1);
+	arr.insert(0, Variant());
+	arr.append_array(arr);
+	arr.resize(3);
+	CHECK(arr.size() == 3);
+	CHECK(Memory::get_alloc_count() == alloc_count);
+
+	// Growing past the inline capacity still works as usual.
+	arr.resize(32);
+	CHECK(arr.size() == 32);
+	CHECK(int(arr[1]) == 1);
+	arr.clear();
+	CHECK(Memory::get_alloc_count() == alloc_count);
+}
+
 TEST_CASE("[Array] front() and back()") {
 	Array arr;
 	arr.push_back(1);
@@ -198,4 +198,20 @@ TEST_CASE("[Callable] Bound and unbound argument count") {
 	memdelete(test_instance);
 }
 
+TEST_CASE("[Callable] Binding few arguments doesn't allocate argument storage") {
+	TestBoundUnboundArgumentCount *test_instance = memnew(TestBoundUnboundArgumentCount);
+	Callable test_func = Callable(test_instance, "test_func");
+
+	const uint64_t alloc_count = Memory::get_alloc_count();
+	Callable bound = test_func.bind(1, 2);
+	// Only the CallableCustomBind itself.
+	CHECK(Memory::get_alloc_count() == alloc_count + 1);
+	CHECK(bound.get_bound_arguments_count() == 2);
+
+	bound = Callable();
+	CHECK(Memory::get_alloc_count() == alloc_count);
+
+	memdelete(test_instance);
+}
+
 } // namespace TestCallable
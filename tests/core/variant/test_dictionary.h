@@ -151,6 +151,22 @@ TEST_CASE("[Dictionary] getptr()") {
 	CHECK(key == nullptr);
 }
 
+TEST_CASE("[Dictionary] Values keep their address when inserting") {
+	Dictionary map;
+	map[0] = 0;
+	Variant *first = map.getptr(0);
+	Variant &first_ref = map[0];
+	for (int i = 1; i < 1000; i++) {
+		map[i] = i;
+	}
+	CHECK(first == map.getptr(0));
+	CHECK(&first_ref == first);
+
+	// Assigning from a value to a new key must not read a moved value.
+	map[String("copy")] = map[999];
+	CHECK(int(map[String("copy")]) == 999);
+}
+
 TEST_CASE("[Dictionary] get_valid()") {
 	Dictionary map;
 	map[1] = 3;
@@ -30,10 +30,13 @@
 
 #pragma once
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestVariant {
 
@@ -1805,6 +1808,79 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays and strings") {
+	PackedFloat32Array floats;
+	PackedVector3Array vectors;
+	PackedInt64Array ints;
+	for (int i = 0; i < 1000; i++) {
+		floats.push_back(i * 0.25f - 100.0f);
+		vectors.push_back(Vector3(i, -i * 1.5, i * 1e-7));
+		ints.push_back(int64_t(i) * 10000000000LL - 5);
+	}
+	floats.push_back(INFINITY);
+	floats.push_back(-INFINITY);
+
+	Dictionary d;
+	d["floats"] = floats;
+	d["vectors"] = vectors;
+	d["ints"] = ints;
+	d["empty"] = PackedFloat64Array();
+	d["text"] = String::utf8("Ünïcödé \"quoted\"\n日本語");
+	d["name"] = StringName("ascii_only");
+
+	String d_str;
+	VariantWriter::write_to_string(d, d_str);
+
+	String errs;
+	int line = 0;
+	Variant parsed;
+
+	// Decoded text.
+	VariantParser::StreamString ss;
+	ss.s = d_str;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	CHECK_MESSAGE(parsed == Variant(d), "Should parse back from a string.");
+
+	// UTF-8 bytes, as read from text resources.
+	const String path = TestUtils::get_temp_path("variant_parser.txt");
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	f->store_string(d_str);
+	f = FileAccess::open(path, FileAccess::READ);
+	VariantParser::StreamFile sf;
+	sf.f = f;
+	parsed = Variant();
+	CHECK(VariantParser::parse(&sf, parsed, errs, line) == OK);
+	CHECK_MESSAGE(parsed == Variant(d), "Should parse back from UTF-8.");
+
+	// Escaped non-ASCII characters in UTF-8 streams.
+	f = FileAccess::open(path, FileAccess::WRITE);
+	f->store_string("\"\\u00e9\\U01f600\"");
+	f = FileAccess::open(path, FileAccess::READ);
+	VariantParser::StreamFile sf_escaped;
+	sf_escaped.f = f;
+	CHECK(VariantParser::parse(&sf_escaped, parsed, errs, line) == OK);
+	CHECK(parsed == Variant(String::utf8("é😀")));
+	f.unref();
+	DirAccess::remove_absolute(path);
+
+	ERR_PRINT_OFF;
+	VariantParser::StreamString ss_missing_comma;
+	ss_missing_comma.s = "PackedFloat32Array(1, 2 3)";
+	CHECK(VariantParser::parse(&ss_missing_comma, parsed, errs, line) == ERR_PARSE_ERROR);
+	VariantParser::StreamString ss_identifier;
+	ss_identifier.s = "Vector2(1, foo)";
+	CHECK(VariantParser::parse(&ss_identifier, parsed, errs, line) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON;
+
+	VariantParser::StreamString ss_spaced;
+	ss_spaced.s = "Vector3( -1.5e3 ,\n2,nan ) ";
+	CHECK(VariantParser::parse(&ss_spaced, parsed, errs, line) == OK);
+	Vector3 v = parsed;
+	CHECK(v.x == -1500);
+	CHECK(v.y == 2);
+	CHECK(Math::is_nan(v.z));
+}
+
 TEST_CASE("[Variant] Writer key sorting") {
 	Dictionary d = build_dictionary(StringName("C"), 3, "A", 1, StringName("B"), 2, "D", 4);
 	String d_str;
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  test_editor_file_system.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#ifdef TOOLS_ENABLED
+
+#include "editor/editor_file_system.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+class TestEditorFileSystemAccessor {
+public:
+	using ReimportTest = EditorFileSystem::ReimportTest;
+
+	static void test_for_reimport_parallel(LocalVector<ReimportTest> &p_tests) {
+		EditorFileSystem::_test_for_reimport_parallel(p_tests);
+	}
+};
+
+namespace TestEditorFileSystem {
+
+class _TestReimportImporter : public ResourceImporter {
+	GDCLASS(_TestReimportImporter, ResourceImporter);
+
+public:
+	SafeNumeric<uint32_t> settings_checks;
+	SafeFlag checked_off_main_thread;
+
+	virtual String get_importer_name() const override { return "test_reimport"; }
+	virtual String get_visible_name() const override { return "Test Reimport"; }
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override { p_extensions->push_back("txt"); }
+	virtual String get_save_extension() const override { return "res"; }
+	virtual String get_resource_type() const override { return "Resource"; }
+	virtual void get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset = 0) const override {}
+	virtual bool get_option_visibility(const String &p_path, const String &p_option, const HashMap<StringName, Variant> &p_options) const override { return true; }
+	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override { return OK; }
+
+	// Like the texture importers, this reads state that is only safe to access from the main thread.
+	virtual bool are_import_settings_valid(const String &p_path, const Dictionary &p_meta) const override {
+		const_cast<_TestReimportImporter *>(this)->settings_checks.increment();
+		if (!Thread::is_main_thread()) {
+			const_cast<_TestReimportImporter *>(this)->checked_off_main_thread.set();
+		}
+		return p_meta.get("valid", true);
+	}
+};
+
+static void _write_file(const String &p_path, const String &p_contents) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_contents);
+}
+
+// Writes a source file with up-to-date import metadata, as left behind by a previous import.
+static void _write_imported_source(const String &p_source, const String &p_dest, bool p_settings_valid) {
+	_write_file(p_source, "Source " + p_source.get_file());
+	_write_file(p_dest, "Imported " + p_source.get_file());
+
+	String import_file = "[remap]\n\nimporter=\"test_reimport\"\ntype=\"Resource\"\nuid=\"uid://test_reimport\"\n";
+	import_file += vformat("path=\"%s\"\nmetadata={\n\"valid\": %s\n}\n\n", p_dest, p_settings_valid ? "true" : "false");
+	import_file += vformat("[deps]\n\nsource_file=\"%s\"\ndest_files=[\"%s\"]\n", p_source, p_dest);
+	_write_file(p_source + ".import", import_file);
+
+	const String md5_path = ResourceFormatImporter::get_singleton()->get_import_base_path(p_source) + ".md5";
+	REQUIRE(DirAccess::make_dir_recursive_absolute(md5_path.get_base_dir()) == OK);
+	_write_file(md5_path, vformat("source_md5=\"%s\"\ndest_md5=\"%s\"\n", FileAccess::get_md5(p_source), FileAccess::get_multiple_md5({ p_dest })));
+}
+
+static void _remove_imported_source(const String &p_source, const String &p_dest) {
+	DirAccess::remove_absolute(p_source);
+	DirAccess::remove_absolute(p_source + ".import");
+	DirAccess::remove_absolute(p_dest);
+	DirAccess::remove_absolute(ResourceFormatImporter::get_singleton()->get_import_base_path(p_source) + ".md5");
+}
+
+TEST_CASE("[EditorFileSystem] Parallel test for reimport") {
+	Ref<_TestReimportImporter> importer;
+	importer.instantiate();
+	ResourceFormatImporter::get_singleton()->add_importer(importer);
+
+	enum {
+		UNCHANGED,
+		SOURCE_EDITED,
+		SETTINGS_INVALID,
+		DEST_MISSING,
+		MARKED,
+		FILE_COUNT,
+	};
+
+	Vector<String> sources;
+	Vector<String> dests;
+	LocalVector<TestEditorFileSystemAccessor::ReimportTest> tests;
+	for (int i = 0; i < FILE_COUNT; i++) {
+		sources.push_back(TestUtils::get_temp_path(vformat("reimport_test_%d.txt", i)));
+		dests.push_back(TestUtils::get_temp_path(vformat("reimport_test_%d.res", i)));
+		_write_imported_source(sources[i], dests[i], i != SETTINGS_INVALID);
+
+		TestEditorFileSystemAccessor::ReimportTest test;
+		test.path = sources[i];
+		test.import_md5 = i == MARKED ? String() : FileAccess::get_md5(sources[i] + ".import");
+		tests.push_back(test);
+	}
+	_write_file(sources[SOURCE_EDITED], "Edited source");
+	DirAccess::remove_absolute(dests[DEST_MISSING]);
+
+	TestEditorFileSystemAccessor::test_for_reimport_parallel(tests);
+
+	CHECK_FALSE(tests[UNCHANGED].need_reimport);
+	CHECK(tests[SOURCE_EDITED].need_reimport);
+	CHECK(tests[SETTINGS_INVALID].need_reimport);
+	CHECK(tests[DEST_MISSING].need_reimport);
+	CHECK(tests[MARKED].need_reimport);
+
+	// Only files that pass the other checks ask the importer, and only from the main thread.
+	CHECK(importer->settings_checks.get() == 2);
+	CHECK_FALSE(importer->checked_off_main_thread.is_set());
+	for (const TestEditorFileSystemAccessor::ReimportTest &test : tests) {
+		CHECK(test.importer.is_null());
+	}
+
+	for (int i = 0; i < FILE_COUNT; i++) {
+		_remove_imported_source(sources[i], dests[i]);
+	}
+	ResourceFormatImporter::get_singleton()->remove_importer(importer);
+}
+
+} // namespace TestEditorFileSystem
+
+#endif // TOOLS_ENABLED
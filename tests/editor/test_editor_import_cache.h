@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*  test_editor_import_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef TOOLS_ENABLED
+
+#include "editor/import/editor_import_cache.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEditorImportCache {
+
+class _TestImporter : public ResourceImporter {
+	GDCLASS(_TestImporter, ResourceImporter);
+
+public:
+	virtual String get_importer_name() const override { return "test_importer"; }
+	virtual String get_visible_name() const override { return "Test Importer"; }
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override { p_extensions->push_back("txt"); }
+	virtual String get_save_extension() const override { return "res"; }
+	virtual String get_resource_type() const override { return "Resource"; }
+	virtual void get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset = 0) const override {
+		r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "quality"), 1));
+	}
+	virtual bool get_option_visibility(const String &p_path, const String &p_option, const HashMap<StringName, Variant> &p_options) const override { return true; }
+	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override { return OK; }
+};
+
+static void _write_file(const String &p_path, const String &p_contents) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_contents);
+}
+
+static void _remove_dir(const String &p_path) {
+	Ref<DirAccess> da = DirAccess::open(p_path);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+		DirAccess::remove_absolute(p_path);
+	}
+}
+
+TEST_CASE("[EditorImportCache] Keys") {
+	Ref<_TestImporter> importer;
+	importer.instantiate();
+	List<ResourceImporter::ImportOption> options;
+	importer->get_import_options("", &options);
+	HashMap<StringName, Variant> params;
+	params["quality"] = 1;
+
+	const String source = TestUtils::get_temp_path("import_cache_source.txt");
+	_write_file(source, "Source contents");
+	const String md5 = FileAccess::get_md5(source);
+
+	const String key = EditorImportCache::compute_key(importer, source, md5, options, params);
+	CHECK(key.length() == 64);
+	CHECK_MESSAGE(EditorImportCache::compute_key(importer, source, md5, options, params) == key, "Keys should be stable.");
+	CHECK_MESSAGE(EditorImportCache::compute_key(importer, source, String(), options, params).is_empty(), "Sources that can't be hashed aren't cached.");
+
+	params["quality"] = 2;
+	CHECK_MESSAGE(EditorImportCache::compute_key(importer, source, md5, options, params) != key, "Options should be part of the key.");
+	params["quality"] = 1;
+
+	const String other_source = TestUtils::get_temp_path("import_cache_other.txt");
+	CHECK_MESSAGE(EditorImportCache::compute_key(importer, other_source, md5, options, params) != key, "The source path should be part of the key.");
+
+	// Editing the source invalidates entries stored for it.
+	_write_file(source, "Edited source contents");
+	const String edited_md5 = FileAccess::get_md5(source);
+	CHECK(edited_md5 != md5);
+	CHECK(EditorImportCache::compute_key(importer, source, edited_md5, options, params) != key);
+
+	DirAccess::remove_absolute(source);
+}
+
+TEST_CASE("[EditorImportCache] Store and fetch") {
+	const String cache_path = TestUtils::get_temp_path("import_cache");
+	const String imported_path = TestUtils::get_temp_path("import_cache_imported");
+	_remove_dir(cache_path);
+	_remove_dir(imported_path);
+	REQUIRE(DirAccess::make_dir_recursive_absolute(cache_path) == OK);
+	REQUIRE(DirAccess::make_dir_recursive_absolute(imported_path) == OK);
+
+	const String key = String("0123456789abcdef").repeat(4);
+	const String other_key = String("fedcba9876543210").repeat(4);
+	const String base_path = imported_path.path_join("icon.png-0123");
+	Vector<String> dest_paths = { base_path + ".ctex", base_path + ".s3tc.ctex" };
+	_write_file(dest_paths[0], "Imported");
+	_write_file(dest_paths[1], "Imported S3TC");
+	List<String> variants;
+	variants.push_back("s3tc");
+	Dictionary metadata;
+	metadata["vram_texture"] = true;
+
+	CHECK_FALSE_MESSAGE(EditorImportCache::fetch(cache_path, key, base_path, &variants, nullptr), "Nothing is stored yet.");
+	REQUIRE(EditorImportCache::store(cache_path, key, base_path, dest_paths, variants, metadata));
+	CHECK_FALSE_MESSAGE(EditorImportCache::store(cache_path, key, base_path, dest_paths, variants, metadata), "Entries are never overwritten.");
+
+	SUBCASE("Files outside the import base path aren't stored") {
+		const Vector<String> foreign_paths = { imported_path.path_join("other.png-4567.ctex") };
+		_write_file(foreign_paths[0], "Foreign");
+		CHECK_FALSE(EditorImportCache::store(cache_path, other_key, base_path, foreign_paths, List<String>(), Variant()));
+		CHECK_FALSE(EditorImportCache::fetch(cache_path, other_key, base_path, nullptr, nullptr));
+	}
+
+	SUBCASE("Fetching restores the files") {
+		for (const String &dest : dest_paths) {
+			DirAccess::remove_absolute(dest);
+		}
+		List<String> fetched_variants;
+		Variant fetched_metadata;
+		REQUIRE(EditorImportCache::fetch(cache_path, key, base_path, &fetched_variants, &fetched_metadata));
+		CHECK(FileAccess::get_file_as_string(dest_paths[0]) == "Imported");
+		CHECK(FileAccess::get_file_as_string(dest_paths[1]) == "Imported S3TC");
+		REQUIRE(fetched_variants.size() == 1);
+		CHECK(fetched_variants.front()->get() == "s3tc");
+		CHECK(fetched_metadata == Variant(metadata));
+	}
+
+	_remove_dir(cache_path);
+	_remove_dir(imported_path);
+}
+
+} // namespace TestEditorImportCache
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,333 @@
+/**************************************************************************/
+/*  test_http_request.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/io/stream_peer_tcp.h"
+#include "core/io/tcp_server.h"
+#include "scene/main/http_request.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+#include <functional>
+
+namespace TestHTTPRequest {
+
+const int PORT = 12346;
+const IPAddress LOCALHOST("127.0.0.1");
+const uint32_t SLEEP_DURATION = 1000;
+const uint64_t MAX_WAIT_USEC = 2000000;
+
+// Processes the tree until the condition is met, so the HTTPRequest can poll its connection.
+void wait_for_condition(std::function<bool()> f_test) {
+	const uint64_t time = OS::get_singleton()->get_ticks_usec();
+	while (!f_test() && (OS::get_singleton()->get_ticks_usec() - time) < MAX_WAIT_USEC) {
+		SceneTree::get_singleton()->process(0);
+		OS::get_singleton()->delay_usec(SLEEP_DURATION);
+	}
+}
+
+String read_request(const Ref<StreamPeerTCP> &p_peer) {
+	String request;
+	wait_for_condition([&]() {
+		p_peer->poll();
+		int available = p_peer->get_available_bytes();
+		if (available > 0) {
+			Vector<uint8_t> data;
+			data.resize(available);
+			p_peer->get_data(data.ptrw(), available);
+			request += String::utf8((const char *)data.ptr(), available);
+		}
+		return request.ends_with("\r\n\r\n");
+	});
+	return request;
+}
+
+void send_response(const Ref<StreamPeerTCP> &p_peer, const String &p_response) {
+	CharString response = p_response.utf8();
+	p_peer->put_data((const uint8_t *)response.get_data(), response.length());
+}
+
+Array completed_args(HTTPRequest::Result p_result, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_body) {
+	Array args;
+	args.push_back(p_result);
+	args.push_back(p_code);
+	args.push_back(p_headers);
+	args.push_back(p_body);
+	Array signal_args;
+	signal_args.push_back(args);
+	return signal_args;
+}
+
+void wait_for_completion(HTTPRequest *p_request) {
+	wait_for_condition([&]() {
+		return !p_request->is_processing_internal();
+	});
+	// Emits the deferred signals.
+	SceneTree::get_singleton()->process(0);
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Keep-alive connections are reused") {
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE_EQ(server->listen(PORT, LOCALHOST), OK);
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	request->set_use_connection_pool(true);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	SIGNAL_WATCH(request, SNAME("request_completed"));
+
+	PackedStringArray headers;
+	headers.push_back("Content-Length: 2");
+	PackedByteArray body;
+	body.push_back('o');
+	body.push_back('k');
+
+	REQUIRE_EQ(request->request("http://127.0.0.1:12346/first"), OK);
+	wait_for_condition([&]() {
+		return server->is_connection_available();
+	});
+	REQUIRE(server->is_connection_available());
+	Ref<StreamPeerTCP> peer = server->take_connection();
+
+	CHECK(read_request(peer).begins_with("GET /first HTTP/1.1"));
+	send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+	wait_for_completion(request);
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+
+	// The second request is sent on the same connection.
+	REQUIRE_EQ(request->request("http://127.0.0.1:12346/second"), OK);
+	CHECK(read_request(peer).begins_with("GET /second HTTP/1.1"));
+	CHECK_FALSE(server->is_connection_available());
+	send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+	wait_for_completion(request);
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+
+	SIGNAL_UNWATCH(request, SNAME("request_completed"));
+	memdelete(request);
+	HTTPRequest::clear_connection_pool();
+	peer->disconnect_from_host();
+	server->stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Stream a chunked body") {
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE_EQ(server->listen(PORT, LOCALHOST), OK);
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	request->set_use_connection_pool(true);
+	request->set_stream_body(true);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	SIGNAL_WATCH(request, SNAME("body_chunk_received"));
+	SIGNAL_WATCH(request, SNAME("request_completed"));
+
+	REQUIRE_EQ(request->request("http://127.0.0.1:12346/stream"), OK);
+	wait_for_condition([&]() {
+		return server->is_connection_available();
+	});
+	REQUIRE(server->is_connection_available());
+	Ref<StreamPeerTCP> peer = server->take_connection();
+
+	CHECK(read_request(peer).begins_with("GET /stream HTTP/1.1"));
+	send_response(peer, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n2\r\nok\r\n0\r\n\r\n");
+	wait_for_completion(request);
+
+	PackedStringArray headers;
+	headers.push_back("Transfer-Encoding: chunked");
+	PackedByteArray chunk;
+	chunk.push_back('o');
+	chunk.push_back('k');
+	Array chunk_args;
+	chunk_args.push_back(chunk);
+	Array signal_args;
+	signal_args.push_back(chunk_args);
+	SIGNAL_CHECK(SNAME("body_chunk_received"), signal_args);
+	// The body is not accumulated when streamed.
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, PackedByteArray()));
+
+	SIGNAL_UNWATCH(request, SNAME("body_chunk_received"));
+	SIGNAL_UNWATCH(request, SNAME("request_completed"));
+	memdelete(request);
+	HTTPRequest::clear_connection_pool();
+	peer->disconnect_from_host();
+	server->stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Connections per host are capped") {
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE_EQ(server->listen(PORT, LOCALHOST), OK);
+
+	const Variant max_connections = GLOBAL_GET("network/limits/http_request/max_connections_per_host");
+	ProjectSettings::get_singleton()->set_setting("network/limits/http_request/max_connections_per_host", 1);
+
+	HTTPRequest *first = memnew(HTTPRequest);
+	HTTPRequest *second = memnew(HTTPRequest);
+	first->set_use_connection_pool(true);
+	second->set_use_connection_pool(true);
+	SceneTree::get_singleton()->get_root()->add_child(first);
+	SceneTree::get_singleton()->get_root()->add_child(second);
+	SIGNAL_WATCH(first, SNAME("request_completed"));
+	SIGNAL_WATCH(second, SNAME("request_completed"));
+
+	PackedStringArray headers;
+	headers.push_back("Content-Length: 2");
+	PackedByteArray body;
+	body.push_back('o');
+	body.push_back('k');
+
+	REQUIRE_EQ(first->request("http://127.0.0.1:12346/first"), OK);
+	REQUIRE_EQ(second->request("http://127.0.0.1:12346/second"), OK);
+	wait_for_condition([&]() {
+		return server->is_connection_available();
+	});
+	REQUIRE(server->is_connection_available());
+	Ref<StreamPeerTCP> peer = server->take_connection();
+	CHECK(read_request(peer).begins_with("GET /first HTTP/1.1"));
+
+	// The second request waits for the connection of the first one.
+	CHECK_FALSE(server->is_connection_available());
+	CHECK(second->is_processing_internal());
+	send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+	wait_for_completion(first);
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+
+	CHECK(read_request(peer).begins_with("GET /second HTTP/1.1"));
+	CHECK_FALSE(server->is_connection_available());
+	send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+	wait_for_completion(second);
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+
+	SIGNAL_UNWATCH(first, SNAME("request_completed"));
+	SIGNAL_UNWATCH(second, SNAME("request_completed"));
+	memdelete(first);
+	memdelete(second);
+	HTTPRequest::clear_connection_pool();
+	ProjectSettings::get_singleton()->set_setting("network/limits/http_request/max_connections_per_host", max_connections);
+	peer->disconnect_from_host();
+	server->stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Stale pooled connections") {
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE_EQ(server->listen(PORT, LOCALHOST), OK);
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	request->set_use_connection_pool(true);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	SIGNAL_WATCH(request, SNAME("request_completed"));
+
+	PackedStringArray headers;
+	headers.push_back("Content-Length: 2");
+	PackedByteArray body;
+	body.push_back('o');
+	body.push_back('k');
+
+	REQUIRE_EQ(request->request("http://127.0.0.1:12346/first"), OK);
+	wait_for_condition([&]() {
+		return server->is_connection_available();
+	});
+	REQUIRE(server->is_connection_available());
+	Ref<StreamPeerTCP> peer = server->take_connection();
+	CHECK(read_request(peer).begins_with("GET /first HTTP/1.1"));
+	send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+	wait_for_completion(request);
+	SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+
+	SUBCASE("Idempotent requests are retried on a new connection") {
+		REQUIRE_EQ(request->request("http://127.0.0.1:12346/second"), OK);
+		CHECK(read_request(peer).begins_with("GET /second HTTP/1.1"));
+		// Close the connection without answering, as a server dropping an idle connection would.
+		peer->disconnect_from_host();
+		wait_for_condition([&]() {
+			return server->is_connection_available();
+		});
+		REQUIRE(server->is_connection_available());
+		peer = server->take_connection();
+		CHECK(read_request(peer).begins_with("GET /second HTTP/1.1"));
+		send_response(peer, "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+		wait_for_completion(request);
+		SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_SUCCESS, 200, headers, body));
+	}
+
+	SUBCASE("Other requests are not retried") {
+		REQUIRE_EQ(request->request("http://127.0.0.1:12346/second", Vector<String>(), HTTPClient::METHOD_POST, "data"), OK);
+		CHECK(read_request(peer).begins_with("POST /second HTTP/1.1"));
+		peer->disconnect_from_host();
+		wait_for_completion(request);
+		CHECK_FALSE(server->is_connection_available());
+		SIGNAL_CHECK(SNAME("request_completed"), completed_args(HTTPRequest::RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray()));
+	}
+
+	SIGNAL_UNWATCH(request, SNAME("request_completed"));
+	memdelete(request);
+	HTTPRequest::clear_connection_pool();
+	peer->disconnect_from_host();
+	server->stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Closed connections are not pooled") {
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE_EQ(server->listen(PORT, LOCALHOST), OK);
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	request->set_use_connection_pool(true);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+
+	const String responses[] = {
+		"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok",
+		"HTTP/1.0 200 OK\r\nContent-Length: 2\r\n\r\nok",
+	};
+	for (const String &response : responses) {
+		REQUIRE_EQ(request->request("http://127.0.0.1:12346/"), OK);
+		wait_for_condition([&]() {
+			return server->is_connection_available();
+		});
+		// Each request needs a new connection.
+		REQUIRE(server->is_connection_available());
+		Ref<StreamPeerTCP> peer = server->take_connection();
+		CHECK(read_request(peer).begins_with("GET / HTTP/1.1"));
+		send_response(peer, response);
+		wait_for_completion(request);
+		peer->disconnect_from_host();
+	}
+
+	memdelete(request);
+	HTTPRequest::clear_connection_pool();
+	server->stop();
+}
+
+} // namespace TestHTTPRequest
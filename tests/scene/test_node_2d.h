@@ -210,4 +210,30 @@ TEST_CASE("[SceneTree][Node2D] Utility methods") {
 	memdelete(test_node1);
 }
 
+TEST_CASE("[SceneTree][Node2D] Redraws are postponed while rendering updates are disabled") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node2D *test_node = memnew(Node2D);
+	tree->get_root()->add_child(test_node);
+	tree->process(0); // Draw once after entering the tree.
+
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+	SIGNAL_WATCH(test_node, SceneStringName(draw));
+
+	tree->set_disable_rendering_updates(true);
+	CHECK(tree->is_rendering_updates_disabled());
+	test_node->queue_redraw();
+	tree->process(0);
+	SIGNAL_CHECK_FALSE(SceneStringName(draw));
+
+	// The redraw requested while disabled runs once updates are enabled again.
+	tree->set_disable_rendering_updates(false);
+	CHECK_FALSE(tree->is_rendering_updates_disabled());
+	tree->process(0);
+	SIGNAL_CHECK(SceneStringName(draw), empty_signal_args);
+
+	SIGNAL_UNWATCH(test_node, SceneStringName(draw));
+	memdelete(test_node);
+}
+
 } // namespace TestNode2D
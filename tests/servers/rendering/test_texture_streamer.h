@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  test_texture_streamer.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "servers/rendering/texture_streamer.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTextureStreamer {
+
+static uint64_t mip_memory(int p_size, int p_mip) {
+	return Image::get_image_data_size(p_size >> p_mip, p_size >> p_mip, Image::FORMAT_RGBA8, true);
+}
+
+TEST_CASE("[TextureStreamer] Requests pick the resident mipmap") {
+	TextureStreamer streamer;
+	streamer.set_enabled(true);
+	streamer.set_min_resident_size(128);
+
+	const RID texture = RID::from_uint64(1);
+	streamer.texture_add(texture, 1024, 1024, 10, Image::FORMAT_RGBA8, 3, Callable());
+	CHECK(streamer.texture_is_streamed(texture));
+	CHECK(streamer.texture_get_resident_mip(texture) == 3);
+	CHECK(streamer.get_resident_memory() == mip_memory(1024, 3));
+
+	streamer.update();
+	CHECK_MESSAGE(streamer.texture_get_resident_mip(texture) == 3, "Nothing should change without requests.");
+
+	streamer.texture_request(texture, 300);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(texture) == 1);
+
+	streamer.texture_request(texture, 2000);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(texture) == 0);
+	CHECK(streamer.get_resident_memory() == mip_memory(1024, 0));
+
+	streamer.texture_request(texture, 10);
+	streamer.update();
+	CHECK_MESSAGE(streamer.texture_get_resident_mip(texture) == 0, "Detail should only be dropped when over budget.");
+
+	streamer.texture_remove(texture);
+	CHECK_FALSE(streamer.texture_is_streamed(texture));
+	CHECK(streamer.get_resident_memory() == 0);
+}
+
+TEST_CASE("[TextureStreamer] Budget evicts least recently used textures") {
+	TextureStreamer streamer;
+	streamer.set_enabled(true);
+	streamer.set_min_resident_size(128);
+	streamer.set_budget(mip_memory(1024, 0) + mip_memory(1024, 3));
+
+	const RID a = RID::from_uint64(1);
+	const RID b = RID::from_uint64(2);
+	streamer.texture_add(a, 1024, 1024, 10, Image::FORMAT_RGBA8, 3, Callable());
+	streamer.texture_add(b, 1024, 1024, 10, Image::FORMAT_RGBA8, 3, Callable());
+
+	streamer.texture_request(a, 1024);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(a) == 0);
+	CHECK(streamer.texture_get_resident_mip(b) == 3);
+
+	// Only one texture fits at full size, so the one not seen this frame goes back to its minimum.
+	streamer.texture_request(b, 1024);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(a) == 3);
+	CHECK(streamer.texture_get_resident_mip(b) == 0);
+	CHECK(streamer.get_resident_memory() <= streamer.get_budget());
+
+	// Both visible, detail is taken from both until they fit.
+	streamer.texture_request(a, 1024);
+	streamer.texture_request(b, 1024);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(a) > 0);
+	CHECK(streamer.texture_get_resident_mip(b) > 0);
+	CHECK(streamer.get_resident_memory() <= streamer.get_budget());
+}
+
+TEST_CASE("[TextureStreamer] Material requests") {
+	TextureStreamer streamer;
+	streamer.set_enabled(true);
+	streamer.set_min_resident_size(64);
+
+	const RID texture = RID::from_uint64(1);
+	const RID material = RID::from_uint64(2);
+	streamer.texture_add(texture, 512, 512, 9, Image::FORMAT_RGBA8, 3, Callable());
+	streamer.material_set_param(material, SNAME("albedo_texture"), texture);
+
+	TextureStreamer::MaterialRequest request;
+	request.material = material;
+	request.screen_size = 256;
+	streamer.request_materials(&request, 1);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(texture) == 1);
+
+	// Clearing the parameter stops the material from requesting the texture.
+	streamer.material_set_param(material, SNAME("albedo_texture"), RID());
+	request.screen_size = 512;
+	streamer.request_materials(&request, 1);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(texture) == 1);
+
+	streamer.free(texture);
+	CHECK_FALSE(streamer.texture_is_streamed(texture));
+}
+
+TEST_CASE("[TextureStreamer] Nothing is tracked while disabled") {
+	TextureStreamer streamer;
+	const RID texture = RID::from_uint64(1);
+	const RID material = RID::from_uint64(2);
+
+	streamer.texture_add(texture, 512, 512, 9, Image::FORMAT_RGBA8, 3, Callable());
+	CHECK_FALSE(streamer.texture_is_streamed(texture));
+	CHECK(streamer.get_resident_memory() == 0);
+
+	streamer.set_enabled(true);
+	streamer.texture_add(texture, 512, 512, 9, Image::FORMAT_RGBA8, 3, Callable());
+	streamer.material_set_param(material, SNAME("albedo_texture"), texture);
+	CHECK(streamer.texture_is_streamed(texture));
+
+	streamer.set_enabled(false);
+	CHECK_FALSE(streamer.texture_is_streamed(texture));
+	CHECK(streamer.get_resident_memory() == 0);
+
+	// Material parameters set before disabling are gone too.
+	streamer.set_enabled(true);
+	streamer.texture_add(texture, 512, 512, 9, Image::FORMAT_RGBA8, 3, Callable());
+	TextureStreamer::MaterialRequest request;
+	request.material = material;
+	request.screen_size = 512;
+	streamer.request_materials(&request, 1);
+	streamer.update();
+	CHECK(streamer.texture_get_resident_mip(texture) == 3);
+}
+
+} // namespace TestTextureStreamer
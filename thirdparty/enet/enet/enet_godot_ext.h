@@ -50,4 +50,10 @@ ENET_API int enet_host_dtls_server_setup (ENetHost *, void *);
 ENET_API int enet_host_dtls_client_setup (ENetHost *, const char *, void *);
 ENET_API void enet_host_refuse_new_connections (ENetHost *, int);
 
+/** Sends the datagrams queued by enet_socket_send, which batches the ones sent while flushing a host.
+    @retval 0 on success
+    @retval < 0 on failure
+*/
+ENET_API int enet_socket_flush (ENetSocket);
+
 #endif // __ENET_GODOT_EXT_H__
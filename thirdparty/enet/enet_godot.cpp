@@ -54,6 +54,26 @@ public:
 	virtual void close() = 0;
 	virtual void set_refuse_new_connections(bool p_enable) {} /* Only used by dtls server */
 	virtual bool can_upgrade() { return false; } /* Only true in ENetUDP */
+
+	/* Sends a datagram gathered from the buffers, which may be queued until flush(). */
+	virtual Error queue_sendto(const ENetBuffer *p_buffers, size_t p_buffer_count, int &r_sent, IPAddress p_ip, uint16_t p_port) {
+		int size = 0;
+		for (size_t i = 0; i < p_buffer_count; i++) {
+			size += p_buffers[i].dataLength;
+		}
+
+		Vector<uint8_t> out;
+		out.resize(size);
+		uint8_t *w = out.ptrw();
+		int pos = 0;
+		for (size_t i = 0; i < p_buffer_count; i++) {
+			memcpy(&w[pos], p_buffers[i].data, p_buffers[i].dataLength);
+			pos += p_buffers[i].dataLength;
+		}
+		return sendto(w, size, r_sent, p_ip, p_port);
+	}
+	virtual Error flush() { return OK; }
+
 	virtual ~ENetGodotSocket() {}
 };
 
@@ -66,10 +86,26 @@ class ENetUDP : public ENetGodotSocket {
 	friend class ENetDTLSServer;
 
 private:
+	enum {
+		RECV_BATCH_SIZE = 16,
+		SEND_BATCH_SIZE = 16,
+	};
+
 	Ref<NetSocket> sock;
 	IPAddress local_address;
 	bool bound = false;
 
+	// ENet reads one datagram at a time, so receive them in batches and serve them from here.
+	LocalVector<uint8_t> recv_buffer;
+	NetSocket::Datagram recv_datagrams[RECV_BATCH_SIZE];
+	int recv_count = 0;
+	int recv_pos = 0;
+
+	// ENet sends one datagram per peer while flushing its commands, queue them and send them all at once.
+	LocalVector<uint8_t> send_buffer;
+	NetSocket::Datagram send_datagrams[SEND_BATCH_SIZE];
+	int send_count = 0;
+
 public:
 	ENetUDP() {
 		sock = Ref<NetSocket>(NetSocket::create());
@@ -103,12 +139,93 @@ public:
 		return sock->sendto(p_buffer, p_len, r_sent, p_ip, p_port);
 	}
 
+	Error queue_sendto(const ENetBuffer *p_buffers, size_t p_buffer_count, int &r_sent, IPAddress p_ip, uint16_t p_port) {
+		int size = 0;
+		for (size_t i = 0; i < p_buffer_count; i++) {
+			size += p_buffers[i].dataLength;
+		}
+		if (size > ENET_PROTOCOL_MAXIMUM_MTU) {
+			Error err = flush();
+			if (err != OK) {
+				return err;
+			}
+			return ENetGodotSocket::queue_sendto(p_buffers, p_buffer_count, r_sent, p_ip, p_port);
+		}
+		if (send_count == SEND_BATCH_SIZE) {
+			Error err = flush();
+			if (err != OK) {
+				return err;
+			}
+		}
+		if (send_buffer.is_empty()) {
+			send_buffer.resize(SEND_BATCH_SIZE * ENET_PROTOCOL_MAXIMUM_MTU);
+			for (int i = 0; i < SEND_BATCH_SIZE; i++) {
+				send_datagrams[i].buffer = &send_buffer[i * ENET_PROTOCOL_MAXIMUM_MTU];
+			}
+		}
+
+		NetSocket::Datagram &datagram = send_datagrams[send_count++];
+		int pos = 0;
+		for (size_t i = 0; i < p_buffer_count; i++) {
+			memcpy(datagram.buffer + pos, p_buffers[i].data, p_buffers[i].dataLength);
+			pos += p_buffers[i].dataLength;
+		}
+		datagram.size = size;
+		datagram.ip = p_ip;
+		datagram.port = p_port;
+		r_sent = size;
+		return OK;
+	}
+
+	Error flush() {
+		int pos = 0;
+		while (pos < send_count) {
+			int sent = 0;
+			Error err = sock->sendto_batch(&send_datagrams[pos], send_count - pos, sent);
+			if (err == ERR_BUSY) {
+				break; // Dropped, like a datagram sent while busy.
+			}
+			if (err != OK) {
+				send_count = 0;
+				return err;
+			}
+			pos += sent;
+		}
+		send_count = 0;
+		return OK;
+	}
+
 	Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port) {
-		Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
-		if (err != OK) {
-			return err;
+		if (recv_pos == recv_count) {
+			recv_pos = 0;
+			recv_count = 0;
+			Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
+			if (err != OK) {
+				return err;
+			}
+			if (recv_buffer.is_empty()) {
+				recv_buffer.resize(RECV_BATCH_SIZE * ENET_PROTOCOL_MAXIMUM_MTU);
+				for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+					recv_datagrams[i].buffer = &recv_buffer[i * ENET_PROTOCOL_MAXIMUM_MTU];
+				}
+			}
+			for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+				recv_datagrams[i].size = ENET_PROTOCOL_MAXIMUM_MTU;
+			}
+			err = sock->recvfrom_batch(recv_datagrams, RECV_BATCH_SIZE, recv_count);
+			if (err != OK) {
+				return err;
+			}
 		}
-		return sock->recvfrom(p_buffer, p_len, r_read, r_ip, r_port);
+		const NetSocket::Datagram &datagram = recv_datagrams[recv_pos++];
+		if (datagram.size > p_len) {
+			return ERR_OUT_OF_MEMORY;
+		}
+		memcpy(p_buffer, datagram.buffer, datagram.size);
+		r_read = datagram.size;
+		r_ip = datagram.ip;
+		r_port = datagram.port;
+		return OK;
 	}
 
 	int set_option(ENetSocketOption p_option, int p_value) {
@@ -156,6 +273,9 @@ public:
 	void close() {
 		sock->close();
 		local_address.clear();
+		recv_count = 0;
+		recv_pos = 0;
+		send_count = 0;
 	}
 };
 
@@ -498,28 +618,12 @@ int enet_socket_send(ENetSocket socket, const ENetAddress *address, const ENetBu
 	ENetGodotSocket *sock = (ENetGodotSocket *)socket;
 	IPAddress dest;
 	Error err;
-	size_t i = 0;
 
 	dest.set_ipv6(address->host);
 
-	// Create a single packet.
-	Vector<uint8_t> out;
-	uint8_t *w;
-	int size = 0;
-	int pos = 0;
-	for (i = 0; i < bufferCount; i++) {
-		size += buffers[i].dataLength;
-	}
-
-	out.resize(size);
-	w = out.ptrw();
-	for (i = 0; i < bufferCount; i++) {
-		memcpy(&w[pos], buffers[i].data, buffers[i].dataLength);
-		pos += buffers[i].dataLength;
-	}
-
+	// Sent by enet_socket_flush() if queued.
 	int sent = 0;
-	err = sock->sendto((const uint8_t *)&w[0], size, sent, dest, address->port);
+	err = sock->queue_sendto(buffers, bufferCount, sent, dest, address->port);
 	if (err != OK) {
 		if (err == ERR_BUSY) { // Blocking call
 			return 0;
@@ -532,6 +636,15 @@ int enet_socket_send(ENetSocket socket, const ENetAddress *address, const ENetBu
 	return sent;
 }
 
+int enet_socket_flush(ENetSocket socket) {
+	ENetGodotSocket *sock = (ENetGodotSocket *)socket;
+	if (sock->flush() != OK) {
+		WARN_PRINT("Sending failed!");
+		return -1;
+	}
+	return 0;
+}
+
 int enet_socket_receive(ENetSocket socket, ENetAddress *address, ENetBuffer *buffers, size_t bufferCount) {
 	ERR_FAIL_COND_V(bufferCount != 1, -1);
 
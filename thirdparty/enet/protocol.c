@@ -1596,7 +1596,7 @@ enet_protocol_check_outgoing_commands (ENetHost * host, ENetPeer * peer, ENetLis
 }
 
 static int
-enet_protocol_send_outgoing_commands (ENetHost * host, ENetEvent * event, int checkForTimeouts)
+enet_protocol_queue_outgoing_commands (ENetHost * host, ENetEvent * event, int checkForTimeouts)
 {
     enet_uint8 headerData [sizeof (ENetProtocolHeader) + sizeof (enet_uint32)];
     ENetProtocolHeader * header = (ENetProtocolHeader *) headerData;
@@ -1741,6 +1741,18 @@ enet_protocol_send_outgoing_commands (ENetHost * host, ENetEvent * event, int ch
     return 0;
 }
 
+static int
+enet_protocol_send_outgoing_commands (ENetHost * host, ENetEvent * event, int checkForTimeouts)
+{
+    int result = enet_protocol_queue_outgoing_commands (host, event, checkForTimeouts);
+
+    /* Don't lose a dispatched event to a failed send. */
+    if (enet_socket_flush (host -> socket) < 0 && result == 0)
+      return -1;
+
+    return result;
+}
+
 /** Sends any queued packets on the host specified to its designated peers.
 
     @param host   host to flush
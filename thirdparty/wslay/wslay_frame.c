@@ -30,6 +30,27 @@
 
 #include "wslay_net.h"
 
+/* Masks len bytes of src into dst (which may be the same buffer), 8 bytes
+   at a time. off is the payload offset of src[0]. */
+static void wslay_mask_payload(uint8_t *dst, const uint8_t *src, size_t len,
+                               const uint8_t *key, uint64_t off) {
+  uint8_t rkey[8];
+  uint64_t key64, v;
+  size_t i;
+  for (i = 0; i < 8; ++i) {
+    rkey[i] = key[(off + i) % 4];
+  }
+  memcpy(&key64, rkey, 8);
+  for (i = 0; i + 8 <= len; i += 8) {
+    memcpy(&v, src + i, 8);
+    v ^= key64;
+    memcpy(dst + i, &v, 8);
+  }
+  for (; i < len; ++i) {
+    dst[i] = src[i] ^ rkey[i % 8];
+  }
+}
+
 #define wslay_min(A, B) (((A) < (B)) ? (A) : (B))
 
 int wslay_frame_context_init(wslay_frame_context_ptr *ctx,
@@ -140,10 +161,8 @@ ssize_t wslay_frame_send(wslay_frame_context_ptr ctx,
               datamark + wslay_min(sizeof(temp), datalen);
           size_t writelen = (size_t)(writelimit - datamark);
           ssize_t r;
-          size_t i;
-          for (i = 0; i < writelen; ++i) {
-            temp[i] = datamark[i] ^ ctx->omaskkey[(ctx->opayloadoff + i) % 4];
-          }
+          wslay_mask_payload(temp, datamark, writelen, ctx->omaskkey,
+                             ctx->opayloadoff);
           r = ctx->callbacks.send_callback(temp, writelen, 0, ctx->user_data);
           if (r > 0) {
             if ((size_t)r > writelen) {
@@ -189,7 +208,6 @@ ssize_t wslay_frame_write(wslay_frame_context_ptr ctx,
                           struct wslay_frame_iocb *iocb, uint8_t *buf,
                           size_t buflen, size_t *pwpayloadlen) {
   uint8_t *buf_last = buf;
-  size_t i;
   size_t hdlen;
 
   *pwpayloadlen = 0;
@@ -268,10 +286,9 @@ ssize_t wslay_frame_write(wslay_frame_context_ptr ctx,
       size_t writelen = wslay_min(buflen, iocb->data_length);
 
       if (ctx->omask) {
-        for (i = 0; i < writelen; ++i) {
-          *buf_last++ =
-              iocb->data[i] ^ ctx->omaskkey[(ctx->opayloadoff + i) % 4];
-        }
+        wslay_mask_payload(buf_last, iocb->data, writelen, ctx->omaskkey,
+                           ctx->opayloadoff);
+        buf_last += writelen;
       } else {
         memcpy(buf_last, iocb->data, writelen);
         buf_last += writelen;
@@ -414,9 +431,10 @@ ssize_t wslay_frame_recv(wslay_frame_context_ptr ctx,
                     ? ctx->ibuflimit
                     : ctx->ibufmark + rempayloadlen;
     if (ctx->imask) {
-      for (; ctx->ibufmark != readlimit; ++ctx->ibufmark, ++ctx->ipayloadoff) {
-        ctx->ibufmark[0] ^= ctx->imaskkey[ctx->ipayloadoff % 4];
-      }
+      wslay_mask_payload(readmark, readmark, (size_t)(readlimit - readmark),
+                         ctx->imaskkey, ctx->ipayloadoff);
+      ctx->ibufmark = readlimit;
+      ctx->ipayloadoff += (uint64_t)(readlimit - readmark);
     } else {
       ctx->ibufmark = readlimit;
       ctx->ipayloadoff += (uint64_t)(readlimit - readmark);